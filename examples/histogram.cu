@@ -6,6 +6,8 @@
 #include <thrust/inner_product.h>
 #include <thrust/binary_search.h>
 #include <thrust/adjacent_difference.h>
+#include <thrust/histogram.h>
+#include <thrust/extrema.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 
@@ -37,8 +39,9 @@
 //
 // The best histogramming methods depends on the application.
 // If the number of bins is relatively small compared to the 
-// input size, then the binary search-based dense histogram
-// method is probably best.  If the number of bins is comparable
+// input size, then the binning-based dense histogram method,
+// which visits each value once and does not sort, is probably
+// best.  If the number of bins is comparable
 // to the input size, then the reduce_by_key-based sparse method 
 // ought to be faster.  When in doubt, try both and see which
 // is fastest.
@@ -100,6 +103,33 @@ void dense_histogram(const Vector1& input,
   print_vector("histogram", histogram);
 }
 
+// dense histogram using histogram_even
+template <typename Vector1, 
+          typename Vector2>
+void binned_histogram(const Vector1& input,
+                            Vector2& histogram)
+{
+  typedef typename Vector1::value_type ValueType; // input value type
+  typedef typename Vector2::value_type IndexType; // histogram index type
+
+  // print the initial data
+  print_vector("initial data", input);
+
+  // number of histogram bins is equal to the maximum value plus one
+  IndexType num_bins = *thrust::max_element(input.begin(), input.end()) + 1;
+
+  // resize histogram storage
+  histogram.resize(num_bins);
+
+  // count the values in bins of width one, without copying or sorting them
+  thrust::histogram_even(input.begin(), input.end(),
+                         histogram.begin(),
+                         num_bins, ValueType(0), ValueType(num_bins));
+
+  // print the histogram
+  print_vector("histogram", histogram);
+}
+
 // sparse histogram using reduce_by_key
 template <typename Vector1,
           typename Vector2,
@@ -170,6 +200,13 @@ int main(void)
     dense_histogram(input, histogram);
   }
   
+  // demonstrate binned dense histogram method
+  {
+    std::cout << "Binned Dense Histogram" << std::endl;
+    thrust::device_vector<int> histogram;
+    binned_histogram(thrust::device_vector<int>(input), histogram);
+  }
+
   // demonstrate sparse histogram method
   {
     std::cout << "Sparse Histogram" << std::endl;
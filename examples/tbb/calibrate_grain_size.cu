@@ -0,0 +1,179 @@
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system/tbb/vector.h>
+#include <thrust/sort.h>
+#include <thrust/merge.h>
+#include <thrust/random.h>
+#include <thrust/host_vector.h>
+#include <tbb/tick_count.h>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+// This example measures the grain sizes which suit the TBB backend on the
+// current machine and prints them as the macros read by
+// thrust/system/tbb/detail/tuning.h. Define the macros before including
+// Thrust (or pass them to the compiler with -D) to use the measured values
+// instead of the defaults derived from the cache sizes.
+//
+// Usage: calibrate_grain_size [output_file]
+//
+// When output_file is given, the definitions are also written to it so that
+// it may be #included ahead of Thrust.
+
+
+// a comparator which the backend cannot recognize as the default ordering,
+// so that sort uses merge sort rather than radix sort
+struct less_than
+{
+  template<typename T>
+  bool operator()(const T &lhs, const T &rhs) const
+  {
+    return lhs < rhs;
+  }
+};
+
+
+// times f() but not f.setup(), which runs before each trial
+template<typename Function>
+double best_time(Function f, int trials = 5)
+{
+  double best = 1e30;
+
+  for(int i = 0; i < trials; ++i)
+  {
+    f.setup();
+
+    tbb::tick_count start = tbb::tick_count::now();
+    f();
+    double elapsed = (tbb::tick_count::now() - start).seconds();
+
+    if(elapsed < best) best = elapsed;
+  }
+
+  return best;
+}
+
+
+// sorting also merges, so the merge grain is held fixed while the sort
+// threshold varies
+struct sort_trial
+{
+  const thrust::tbb::vector<int> &input;
+  thrust::tbb::vector<int> &keys;
+  std::size_t grain_size;
+  std::size_t merge_grain_size;
+
+  sort_trial(const thrust::tbb::vector<int> &input, thrust::tbb::vector<int> &keys, std::size_t grain_size, std::size_t merge_grain_size)
+    : input(input), keys(keys), grain_size(grain_size), merge_grain_size(merge_grain_size)
+  {}
+
+  void setup() const
+  {
+    keys = input;
+  }
+
+  void operator()() const
+  {
+    thrust::stable_sort(thrust::tbb::par.grain(grain_size).merge_grain(merge_grain_size), keys.begin(), keys.end(), less_than());
+  }
+};
+
+
+struct merge_trial
+{
+  const thrust::tbb::vector<int> &a;
+  const thrust::tbb::vector<int> &b;
+  thrust::tbb::vector<int> &result;
+  std::size_t grain_size;
+
+  merge_trial(const thrust::tbb::vector<int> &a, const thrust::tbb::vector<int> &b, thrust::tbb::vector<int> &result, std::size_t grain_size)
+    : a(a), b(b), result(result), grain_size(grain_size)
+  {}
+
+  void setup() const {}
+
+  void operator()() const
+  {
+    thrust::merge(thrust::tbb::par.grain(grain_size), a.begin(), a.end(), b.begin(), b.end(), result.begin(), less_than());
+  }
+};
+
+
+thrust::tbb::vector<int> random_keys(std::size_t n, unsigned int seed)
+{
+  thrust::default_random_engine rng(seed);
+  thrust::uniform_int_distribution<int> dist;
+
+  thrust::host_vector<int> result(n);
+  for(std::size_t i = 0; i < n; ++i)
+    result[i] = dist(rng);
+
+  return thrust::tbb::vector<int>(result.begin(), result.end());
+}
+
+
+int main(int argc, char **argv)
+{
+  const std::size_t n = 1 << 22;
+
+  // merge: try grain sizes from 64 to 256K elements
+  thrust::tbb::vector<int> input = random_keys(n, 13);
+
+  thrust::tbb::vector<int> a = input;
+  thrust::tbb::vector<int> b = random_keys(n, 17);
+  thrust::stable_sort(thrust::tbb::par, a.begin(), a.end());
+  thrust::stable_sort(thrust::tbb::par, b.begin(), b.end());
+
+  thrust::tbb::vector<int> merged(2 * n);
+
+  std::size_t best_merge_grain = 0;
+  double      best_merge_time  = 1e30;
+
+  for(std::size_t grain = 1 << 6; grain <= (1 << 18); grain *= 2)
+  {
+    double t = best_time(merge_trial(a, b, merged, grain));
+
+    std::cout << "merge grain " << grain << ": " << t * 1e3 << " ms" << std::endl;
+
+    if(t < best_merge_time)
+    {
+      best_merge_time  = t;
+      best_merge_grain = grain;
+    }
+  }
+
+  // sort: try leaf sizes from 4K to 4M elements, merging with the best merge grain
+  thrust::tbb::vector<int> keys(n);
+
+  std::size_t best_sort_grain = 0;
+  double      best_sort_time  = 1e30;
+
+  for(std::size_t grain = 1 << 12; grain <= (1 << 22); grain *= 2)
+  {
+    double t = best_time(sort_trial(input, keys, grain, best_merge_grain), 3);
+
+    std::cout << "sort  grain " << grain << ": " << t * 1e3 << " ms" << std::endl;
+
+    if(t < best_sort_time)
+    {
+      best_sort_time  = t;
+      best_sort_grain = grain;
+    }
+  }
+
+  std::ostringstream definitions;
+  definitions << "#define THRUST_TBB_SORT_THRESHOLD_BYTES " << best_sort_grain  * sizeof(int) << std::endl;
+  definitions << "#define THRUST_TBB_MERGE_GRAIN_BYTES "    << best_merge_grain * sizeof(int) << std::endl;
+
+  std::cout << std::endl << "recommended settings:" << std::endl << definitions.str();
+
+  if(argc > 1)
+  {
+    std::ofstream file(argv[1]);
+    file << "// generated by calibrate_grain_size" << std::endl << definitions.str();
+  }
+
+  return 0;
+}
+
@@ -2,7 +2,8 @@
 // elements of a device_vector. For example, the default behavior of
 // zero-initializing numeric data may introduce undesirable overhead.
 // This example demonstrates how to avoid default construction of a
-// device_vector's data by using a custom allocator.
+// device_vector's data, first with the thrust::no_init tag and then by
+// using a custom allocator.
 
 #include <thrust/device_malloc_allocator.h>
 #include <thrust/device_vector.h>
@@ -32,6 +33,15 @@ typedef thrust::device_vector<float, uninitialized_allocator<float> > uninitiali
 
 int main()
 {
+  // for types with a trivial default constructor, thrust::no_init skips
+  // the initialization of new elements for a single construction or resize
+  thrust::device_vector<float> tagged(10, thrust::no_init);
+
+  // the initial value of tagged's 10 elements is undefined
+
+  tagged.resize(20, thrust::no_init);
+
+  // an allocator with a no-op construct skips initialization everywhere
   uninitialized_vector vec(10);
 
   // the initial value of vec's 10 elements is undefined
@@ -3,6 +3,12 @@
 #include <string>
 #include <algorithm>
 
+#if THRUST_DEVICE_SYSTEM==THRUST_DEVICE_SYSTEM_OMP
+#include <omp.h>
+#elif THRUST_DEVICE_SYSTEM==THRUST_DEVICE_SYSTEM_TBB
+#include <tbb/task_scheduler_init.h>
+#endif
+
 
 //#include <cuda_runtime.h>
 //#include <cuda.h>
@@ -22,6 +28,17 @@
 #define BEGIN_TESTSUITE(name)               { std::cout << "<?xml version=\"1.0\" ?>" << std::endl << "<testsuite  name=\"" << name << "\">" << std::endl; }
 #define END_TESTSUITE()                     { std::cout << "</testsuite>" << std::endl; }
 
+// limit the number of host threads available to the device system (CUDA ignores this).
+// OpenMP's limit is process-wide and persists until the next SET_NUM_THREADS, while
+// TBB's lasts for the rest of the enclosing scope
+#if THRUST_DEVICE_SYSTEM==THRUST_DEVICE_SYSTEM_OMP
+#define SET_NUM_THREADS(n)                  { omp_set_num_threads(n); }
+#elif THRUST_DEVICE_SYSTEM==THRUST_DEVICE_SYSTEM_TBB
+#define SET_NUM_THREADS(n)                  tbb::task_scheduler_init __task_scheduler_init(n);
+#else
+#define SET_NUM_THREADS(n)
+#endif
+
 
 #if defined(__GNUC__)  // GCC
 #define __HOST_COMPILER_NAME__ "GCC"
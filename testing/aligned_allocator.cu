@@ -0,0 +1,82 @@
+#include <unittest/unittest.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/cpp/vector.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+#include <cstddef>
+
+
+template<typename Vector>
+bool is_aligned(const Vector &v, std::size_t alignment)
+{
+  return reinterpret_cast<std::size_t>(thrust::raw_pointer_cast(v.data())) % alignment == 0;
+}
+
+
+template<typename T>
+void TestAlignedAllocator(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::cpp::vector<T, thrust::cpp::aligned_allocator<T> > v(h_data.begin(), h_data.end());
+
+  ASSERT_EQUAL(true, is_aligned(v, 64));
+
+  thrust::cpp::vector<T, thrust::cpp::aligned_allocator<T, 4096> > w(h_data.begin(), h_data.end());
+
+  ASSERT_EQUAL(true, is_aligned(w, 4096));
+
+  thrust::host_vector<T, thrust::cpp::aligned_allocator<T> > h(h_data.begin(), h_data.end());
+
+  ASSERT_EQUAL(true, is_aligned(h, 64));
+
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(v.begin(), v.end()));
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(w.begin(), w.end()));
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(h.begin(), h.end()));
+}
+DECLARE_VARIABLE_UNITTEST(TestAlignedAllocator);
+
+
+void TestHugePageAllocator()
+{
+  // large enough to be advised to use huge pages
+  const size_t n = 1 << 20;
+
+  thrust::cpp::vector<int, thrust::cpp::huge_page_allocator<int> > v(n);
+
+  ASSERT_EQUAL(true, is_aligned(v, 2 << 20));
+
+  // smaller blocks are aligned to a cache line rather than a huge page
+  thrust::cpp::vector<int, thrust::cpp::huge_page_allocator<int> > w(100);
+
+  ASSERT_EQUAL(true, is_aligned(w, 64));
+
+  thrust::sequence(v.begin(), v.end());
+
+  ASSERT_EQUAL(int(n - 1), v.back());
+  ASSERT_EQUAL(true, thrust::reduce(v.begin(), v.end(), 0ll) == (long long)n * (n - 1) / 2);
+}
+DECLARE_UNITTEST(TestHugePageAllocator);
+
+
+void TestHugePageAllocatorTemporaries()
+{
+  thrust::host_vector<int> h_keys = unittest::random_integers<int>(10000);
+  thrust::host_vector<int> h_vals = unittest::random_integers<int>(10000);
+
+  thrust::host_vector<int> keys = h_keys;
+  thrust::host_vector<int> vals = h_vals;
+
+  thrust::cpp::huge_page_allocator<char> alloc;
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_vals.begin());
+  thrust::stable_sort_by_key(thrust::cpp::par(alloc), keys.begin(), keys.end(), vals.begin());
+
+  ASSERT_EQUAL(h_keys, keys);
+  ASSERT_EQUAL(h_vals, vals);
+}
+DECLARE_UNITTEST(TestHugePageAllocatorTemporaries);
+
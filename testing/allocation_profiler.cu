@@ -0,0 +1,85 @@
+#include <unittest/unittest.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/sort.h>
+#include <thrust/reduce.h>
+#include <thrust/host_vector.h>
+
+
+void TestAllocationProfilerCounts()
+{
+  thrust::cpp::allocation_profiler profiler;
+
+  char *ptr1 = profiler.allocate(1000);
+  char *ptr2 = profiler.allocate(3000);
+
+  ptr1[0] = 0; ptr1[999] = 0;
+  ptr2[0] = 0; ptr2[2999] = 0;
+
+  profiler.deallocate(ptr2);
+
+  char *ptr3 = profiler.allocate(500);
+
+  profiler.deallocate(ptr3);
+  profiler.deallocate(ptr1);
+
+  thrust::cpp::allocation_profile profile = profiler.profile();
+
+  ASSERT_EQUAL(3u, profile.num_allocations);
+  ASSERT_EQUAL(4500u, profile.bytes_allocated);
+  ASSERT_EQUAL(4000u, profile.peak_bytes);
+  ASSERT_EQUAL(0u, profile.bytes_in_use);
+  ASSERT_EQUAL(3u, profile.allocation_sizes.size());
+  ASSERT_EQUAL(1000u, profile.allocation_sizes[0]);
+  ASSERT_EQUAL(3000u, profile.allocation_sizes[1]);
+  ASSERT_EQUAL(500u, profile.allocation_sizes[2]);
+
+  profiler.reset();
+
+  profile = profiler.profile();
+
+  ASSERT_EQUAL(0u, profile.num_allocations);
+  ASSERT_EQUAL(0u, profile.bytes_allocated);
+  ASSERT_EQUAL(0u, profile.peak_bytes);
+  ASSERT_EQUAL(0u, profile.allocation_sizes.size());
+}
+DECLARE_UNITTEST(TestAllocationProfilerCounts);
+
+
+void TestAllocationProfilerAlgorithm()
+{
+  const size_t n = 10000;
+
+  thrust::host_vector<int> h_keys = unittest::random_integers<int>(n);
+  thrust::host_vector<int> h_vals = unittest::random_integers<int>(n);
+
+  thrust::host_vector<int> keys = h_keys;
+  thrust::host_vector<int> vals = h_vals;
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_vals.begin());
+
+  thrust::cpp::allocation_profiler profiler;
+
+  thrust::stable_sort_by_key(thrust::cpp::par(profiler), keys.begin(), keys.end(), vals.begin());
+
+  ASSERT_EQUAL(h_keys, keys);
+  ASSERT_EQUAL(h_vals, vals);
+
+  thrust::cpp::allocation_profile profile = profiler.profile();
+
+  // the merge sort needs scratch space for both keys and values
+  ASSERT_EQUAL(true, profile.num_allocations > 0);
+  ASSERT_EQUAL(true, profile.peak_bytes >= n * sizeof(int));
+  ASSERT_EQUAL(true, profile.bytes_allocated >= profile.peak_bytes);
+  ASSERT_EQUAL(0u, profile.bytes_in_use);
+
+  profiler.reset();
+
+  // reduce needs no temporary storage on the host
+  int sum = thrust::reduce(thrust::cpp::par(profiler), keys.begin(), keys.end());
+
+  ASSERT_EQUAL(thrust::reduce(h_keys.begin(), h_keys.end()), sum);
+  ASSERT_EQUAL(0u, profiler.profile().num_allocations);
+}
+DECLARE_UNITTEST(TestAllocationProfilerAlgorithm);
+
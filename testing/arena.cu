@@ -0,0 +1,108 @@
+#include <unittest/unittest.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/copy.h>
+#include <thrust/sort.h>
+#include <thrust/reduce.h>
+#include <thrust/host_vector.h>
+
+
+void TestArenaReuse()
+{
+  thrust::cpp::arena scratch(1 << 16);
+
+  char *ptr1 = scratch.allocate(1000);
+  char *ptr2 = scratch.allocate(1000);
+
+  ASSERT_EQUAL(true, ptr1 < ptr2);
+  ASSERT_EQUAL(0u, reinterpret_cast<size_t>(ptr2) % 64);
+
+  // the most recent piece is reclaimed at once
+  scratch.deallocate(ptr2);
+
+  char *ptr3 = scratch.allocate(500);
+
+  ASSERT_EQUAL(true, ptr2 == ptr3);
+
+  // the others are reclaimed when the arena empties
+  scratch.deallocate(ptr1);
+
+  ASSERT_EQUAL(true, scratch.statistics().bytes_in_use > 0);
+
+  scratch.deallocate(ptr3);
+
+  thrust::cpp::arena_statistics stats = scratch.statistics();
+
+  ASSERT_EQUAL(0u, stats.bytes_in_use);
+  ASSERT_EQUAL(0u, stats.overflows);
+  ASSERT_EQUAL(true, stats.high_water_mark >= 2000u);
+
+  ASSERT_EQUAL(true, scratch.allocate(1000) == ptr1);
+
+  scratch.release();
+
+  ASSERT_EQUAL(0u, scratch.statistics().bytes_in_use);
+}
+DECLARE_UNITTEST(TestArenaReuse);
+
+
+void TestArenaOverflow()
+{
+  thrust::cpp::arena scratch(1024);
+
+  // a request larger than the arena is served by malloc
+  char *ptr = scratch.allocate(4096);
+
+  ptr[0] = 0; ptr[4095] = 0;
+
+  scratch.deallocate(ptr);
+
+  ASSERT_EQUAL(1u, scratch.statistics().overflows);
+  ASSERT_EQUAL(0u, scratch.statistics().bytes_in_use);
+}
+DECLARE_UNITTEST(TestArenaOverflow);
+
+
+struct is_even
+{
+  __host__ __device__
+  bool operator()(int x) const { return x % 2 == 0; }
+};
+
+
+void TestArenaPipeline()
+{
+  const size_t n = 10000;
+
+  thrust::host_vector<int> h_input = unittest::random_integers<int>(n);
+  thrust::host_vector<int> h_values(n, 1);
+
+  for(size_t i = 0; i < n; ++i) h_input[i] %= 100;
+
+  // reference
+  thrust::host_vector<int> ref_keys(n), ref_unique(n), ref_sums(n);
+  size_t ref_m = thrust::copy_if(h_input.begin(), h_input.end(), ref_keys.begin(), is_even()) - ref_keys.begin();
+  thrust::host_vector<int> ref_values = h_values;
+  thrust::sort_by_key(ref_keys.begin(), ref_keys.begin() + ref_m, ref_values.begin());
+  size_t ref_k = thrust::reduce_by_key(ref_keys.begin(), ref_keys.begin() + ref_m, ref_values.begin(), ref_unique.begin(), ref_sums.begin()).first - ref_unique.begin();
+
+  thrust::cpp::arena scratch(16 << 20);
+
+  thrust::host_vector<int> keys(n), unique(n), sums(n);
+  thrust::host_vector<int> values = h_values;
+  size_t m = thrust::copy_if(thrust::cpp::par(scratch), h_input.begin(), h_input.end(), keys.begin(), is_even()) - keys.begin();
+  thrust::sort_by_key(thrust::cpp::par(scratch), keys.begin(), keys.begin() + m, values.begin());
+  size_t k = thrust::reduce_by_key(thrust::cpp::par(scratch), keys.begin(), keys.begin() + m, values.begin(), unique.begin(), sums.begin()).first - unique.begin();
+
+  ASSERT_EQUAL(ref_m, m);
+  ASSERT_EQUAL(ref_k, k);
+  ASSERT_EQUAL(ref_unique, unique);
+  ASSERT_EQUAL(ref_sums, sums);
+
+  thrust::cpp::arena_statistics stats = scratch.statistics();
+
+  ASSERT_EQUAL(0u, stats.overflows);
+  ASSERT_EQUAL(0u, stats.bytes_in_use);
+}
+DECLARE_UNITTEST(TestArenaPipeline);
+
@@ -458,3 +458,133 @@ struct TestVectorBinarySearchDiscardIterator
 };
 VariableUnitTest<TestVectorBinarySearchDiscardIterator, SignedIntegralTypes> TestVectorBinarySearchDiscardIteratorInstance;
 
+
+
+template <class Vector>
+void TestVectorSortedSearchSimple(void)
+{
+    Vector vec(5);
+
+    vec[0] = 0;
+    vec[1] = 2;
+    vec[2] = 5;
+    vec[3] = 7;
+    vec[4] = 8;
+
+    Vector input(10);
+    thrust::sequence(input.begin(), input.end());
+
+    typedef typename vector_like<Vector, int>::type IntVector;
+
+    IntVector integral_output(10);
+    
+    typename IntVector::iterator output_end = thrust::sorted_search(vec.begin(), vec.end(), input.begin(), input.end(), integral_output.begin());
+
+    ASSERT_EQUAL((output_end - integral_output.begin()), 10);
+
+    ASSERT_EQUAL(integral_output[0], 0);
+    ASSERT_EQUAL(integral_output[1], 1);
+    ASSERT_EQUAL(integral_output[2], 1);
+    ASSERT_EQUAL(integral_output[3], 2);
+    ASSERT_EQUAL(integral_output[4], 2);
+    ASSERT_EQUAL(integral_output[5], 2);
+    ASSERT_EQUAL(integral_output[6], 3);
+    ASSERT_EQUAL(integral_output[7], 3);
+    ASSERT_EQUAL(integral_output[8], 4);
+    ASSERT_EQUAL(integral_output[9], 5);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorSortedSearchSimple);
+
+
+template<typename ForwardIterator, typename InputIterator, typename OutputIterator>
+OutputIterator sorted_search(my_system &system, ForwardIterator,ForwardIterator,InputIterator,InputIterator,OutputIterator output)
+{
+    system.validate_dispatch();
+    return output;
+}
+
+void TestVectorSortedSearchDispatchExplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    my_system sys(0);
+    thrust::sorted_search(sys,
+                          vec.begin(),
+                          vec.end(),
+                          vec.begin(),
+                          vec.end(),
+                          vec.begin());
+
+    ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestVectorSortedSearchDispatchExplicit);
+
+
+template<typename ForwardIterator, typename InputIterator, typename OutputIterator>
+OutputIterator sorted_search(my_tag, ForwardIterator,ForwardIterator,InputIterator,InputIterator,OutputIterator output)
+{
+    *output = 13;
+    return output;
+}
+
+void TestVectorSortedSearchDispatchImplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    thrust::sorted_search(thrust::retag<my_tag>(vec.begin()),
+                          thrust::retag<my_tag>(vec.end()),
+                          thrust::retag<my_tag>(vec.begin()),
+                          thrust::retag<my_tag>(vec.end()),
+                          thrust::retag<my_tag>(vec.begin()));
+
+    ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestVectorSortedSearchDispatchImplicit);
+
+
+template <typename T>
+struct TestVectorSortedSearch
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T>   h_vec = unittest::random_integers<T>(n); thrust::sort(h_vec.begin(), h_vec.end());
+    thrust::device_vector<T> d_vec = h_vec;
+
+    thrust::host_vector<T>   h_input = unittest::random_integers<T>(2*n); thrust::sort(h_input.begin(), h_input.end());
+    thrust::device_vector<T> d_input = h_input;
+    
+    thrust::host_vector<int>   h_output(2*n);
+    thrust::device_vector<int> d_output(2*n);
+
+    thrust::lower_bound(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin());
+    thrust::sorted_search(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin());
+
+    ASSERT_EQUAL(h_output, d_output);
+  }
+};
+VariableUnitTest<TestVectorSortedSearch, SignedIntegralTypes> TestVectorSortedSearchInstance;
+
+
+template <typename T>
+struct TestVectorSortedSearchDiscardIterator
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T>   h_vec = unittest::random_integers<T>(n); thrust::sort(h_vec.begin(), h_vec.end());
+    thrust::device_vector<T> d_vec = h_vec;
+
+    thrust::host_vector<T>   h_input = unittest::random_integers<T>(2*n); thrust::sort(h_input.begin(), h_input.end());
+    thrust::device_vector<T> d_input = h_input;
+
+    thrust::discard_iterator<> h_result =
+      thrust::sorted_search(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), thrust::make_discard_iterator());
+    thrust::discard_iterator<> d_result =
+      thrust::sorted_search(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), thrust::make_discard_iterator());
+
+    thrust::discard_iterator<> reference(2*n);
+
+    ASSERT_EQUAL_QUIET(reference, h_result);
+    ASSERT_EQUAL_QUIET(reference, d_result);
+  }
+};
+VariableUnitTest<TestVectorSortedSearchDiscardIterator, SignedIntegralTypes> TestVectorSortedSearchDiscardIteratorInstance;
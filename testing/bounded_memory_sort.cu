@@ -0,0 +1,117 @@
+#include <unittest/unittest.h>
+#include <thrust/sort.h>
+#include <thrust/functional.h>
+
+#if (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP) || (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB)
+
+#if (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP)
+#include <thrust/system/omp/execution_policy.h>
+namespace bounded_system = thrust::system::omp;
+#else
+#include <thrust/system/tbb/execution_policy.h>
+namespace bounded_system = thrust::system::tbb;
+#endif
+
+
+template<typename T>
+struct less_div_10
+{
+  __host__ __device__
+  bool operator()(const T &lhs, const T &rhs) const { return ((int) lhs) / 10 < ((int) rhs) / 10; }
+};
+
+
+template<typename T>
+void TestStableSortBoundedMemory(const size_t n)
+{
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+  const double fractions[] = {0.0, 1.0 / 64, 1.0 / 16, 1.0};
+
+  for(int f = 0; f < 4; ++f)
+  {
+    thrust::device_vector<T> d_keys = h_keys;
+    thrust::host_vector<T>   h_ref  = h_keys;
+
+    thrust::stable_sort(h_ref.begin(), h_ref.end(), less_div_10<T>());
+    thrust::stable_sort(bounded_system::par.bounded_memory(fractions[f]), d_keys.begin(), d_keys.end(), less_div_10<T>());
+
+    ASSERT_EQUAL(h_ref, d_keys);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestStableSortBoundedMemory);
+
+
+template<typename T>
+void TestSortBoundedMemoryDescending(const size_t n)
+{
+  thrust::host_vector<T>   h_keys = unittest::random_integers<T>(n);
+  thrust::device_vector<T> d_keys = h_keys;
+
+  thrust::sort(h_keys.begin(), h_keys.end(), thrust::greater<T>());
+  thrust::sort(bounded_system::par.bounded_memory(), d_keys.begin(), d_keys.end(), thrust::greater<T>());
+
+  ASSERT_EQUAL(h_keys, d_keys);
+}
+DECLARE_VARIABLE_UNITTEST(TestSortBoundedMemoryDescending);
+
+
+template<typename T>
+void TestStableSortByKeyBoundedMemory(const size_t n)
+{
+  thrust::host_vector<T>   h_keys   = unittest::random_integers<T>(n);
+  thrust::host_vector<int> h_values(n);
+
+  for(size_t i = 0; i < n; ++i) h_values[i] = i;
+
+  thrust::device_vector<T>   d_keys   = h_keys;
+  thrust::device_vector<int> d_values = h_values;
+
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), less_div_10<T>());
+  thrust::stable_sort_by_key(bounded_system::par.bounded_memory(1.0 / 32), d_keys.begin(), d_keys.end(), d_values.begin(), less_div_10<T>());
+
+  ASSERT_EQUAL(h_keys,   d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+}
+DECLARE_VARIABLE_UNITTEST(TestStableSortByKeyBoundedMemory);
+
+
+void TestStableSortByKeyBoundedMemoryManyTiles(void)
+{
+  // more than two maximal tiles on any machine, so that the tiles are merged
+  // in pieces, one of them without a partner in the first pass
+  const size_t n = (2 << 20) + 12345;
+
+  thrust::host_vector<int> h_keys = unittest::random_integers<int>(n);
+  thrust::host_vector<int> h_values(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    // many equivalent keys, whose values must stay in order
+    h_keys[i]   = h_keys[i] % 1000;
+    h_values[i] = i;
+  }
+
+  thrust::host_vector<int> h_ref_keys   = h_keys;
+  thrust::host_vector<int> h_ref_values = h_values;
+
+  thrust::stable_sort_by_key(h_ref_keys.begin(), h_ref_keys.end(), h_ref_values.begin(), less_div_10<int>());
+
+  // a tiny fraction leaves most of each merge to the rotations
+  const double fractions[] = {0.0, 1.0 / 1024, 1.0 / 16};
+
+  for(int f = 0; f < 3; ++f)
+  {
+    thrust::device_vector<int> d_keys   = h_keys;
+    thrust::device_vector<int> d_values = h_values;
+
+    thrust::stable_sort_by_key(bounded_system::par.bounded_memory(fractions[f]), d_keys.begin(), d_keys.end(), d_values.begin(), less_div_10<int>());
+
+    ASSERT_EQUAL(h_ref_keys,   d_keys);
+    ASSERT_EQUAL(h_ref_values, d_values);
+  }
+}
+DECLARE_UNITTEST(TestStableSortByKeyBoundedMemoryManyTiles);
+
+#endif
+
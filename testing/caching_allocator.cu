@@ -0,0 +1,90 @@
+#include <unittest/unittest.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/sort.h>
+#include <thrust/host_vector.h>
+
+
+void TestCachingAllocatorReuse()
+{
+  thrust::cpp::caching_allocator pool;
+
+  char *ptr1 = pool.allocate(1000);
+  pool.deallocate(ptr1);
+
+  // a request in the same size class reuses the cached block
+  char *ptr2 = pool.allocate(900);
+
+  ASSERT_EQUAL(true, ptr1 == ptr2);
+
+  pool.deallocate(ptr2);
+
+  thrust::cpp::caching_allocator_statistics stats = pool.statistics();
+
+  ASSERT_EQUAL(1u, stats.hits);
+  ASSERT_EQUAL(1u, stats.misses);
+  ASSERT_EQUAL(true, stats.bytes_retained >= 1000u);
+  ASSERT_EQUAL(stats.bytes_retained, stats.high_water_mark);
+
+  pool.free_all();
+
+  ASSERT_EQUAL(0u, pool.statistics().bytes_retained);
+}
+DECLARE_UNITTEST(TestCachingAllocatorReuse);
+
+
+void TestCachingAllocatorBound()
+{
+  // a cache of zero bytes returns every block to the system
+  thrust::cpp::caching_allocator pool(0);
+
+  pool.deallocate(pool.allocate(1000));
+  pool.deallocate(pool.allocate(1000));
+
+  thrust::cpp::caching_allocator_statistics stats = pool.statistics();
+
+  ASSERT_EQUAL(0u, stats.hits);
+  ASSERT_EQUAL(2u, stats.misses);
+  ASSERT_EQUAL(0u, stats.bytes_retained);
+}
+DECLARE_UNITTEST(TestCachingAllocatorBound);
+
+
+template <typename T>
+struct TestCachingAllocatorSortByKey
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+    thrust::host_vector<T> h_vals = unittest::random_integers<T>(n);
+
+    thrust::host_vector<T> ref_keys = h_keys;
+    thrust::host_vector<T> ref_vals = h_vals;
+    thrust::stable_sort_by_key(ref_keys.begin(), ref_keys.end(), ref_vals.begin());
+
+    thrust::cpp::caching_allocator pool;
+
+    for(int i = 0; i < 2; ++i)
+    {
+      thrust::host_vector<T> keys = h_keys;
+      thrust::host_vector<T> vals = h_vals;
+
+      thrust::stable_sort_by_key(thrust::cpp::par(pool), keys.begin(), keys.end(), vals.begin());
+
+      ASSERT_EQUAL(ref_keys, keys);
+      ASSERT_EQUAL(ref_vals, vals);
+    }
+
+    thrust::cpp::caching_allocator_statistics stats = pool.statistics();
+
+    // the second sort allocates nothing new
+    ASSERT_EQUAL(true, stats.hits >= stats.misses);
+
+    if(n > 0)
+    {
+      ASSERT_EQUAL(true, stats.hits > 0);
+    }
+  }
+};
+VariableUnitTest<TestCachingAllocatorSortByKey, IntegralTypes> TestCachingAllocatorSortByKeyInstance;
+
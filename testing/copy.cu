@@ -562,3 +562,31 @@ void TestCopyIfStencilDispatchImplicit()
 }
 DECLARE_UNITTEST(TestCopyIfStencilDispatchImplicit);
 
+
+
+void TestCopyLargeTrivial()
+{
+    // large enough to be split among threads
+    const size_t n = 1 << 20;
+
+    thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+
+    thrust::device_vector<int> d_data(h_data.begin(), h_data.end());
+    ASSERT_EQUAL(h_data, d_data);
+
+    thrust::device_vector<int> d_copy(d_data);
+    ASSERT_EQUAL(h_data, d_copy);
+
+    thrust::host_vector<int> h_copy(n);
+    thrust::copy(d_copy.begin(), d_copy.end(), h_copy.begin());
+    ASSERT_EQUAL(h_data, h_copy);
+
+    // assignment to a vector of the same size copies in place
+    thrust::fill(d_copy.begin(), d_copy.end(), 0);
+    d_copy = h_data;
+    ASSERT_EQUAL(h_data, d_copy);
+
+    thrust::copy(thrust::make_counting_iterator<int>(0), thrust::make_counting_iterator<int>(n), d_copy.begin());
+    ASSERT_EQUAL(int(n - 1), d_copy.back());
+}
+DECLARE_UNITTEST(TestCopyLargeTrivial);
@@ -0,0 +1,292 @@
+#include <unittest/unittest.h>
+#include <thrust/histogram.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/retag.h>
+#include <cmath>
+#include <limits>
+
+
+template<typename InputIterator, typename RandomAccessIterator, typename Size, typename T>
+RandomAccessIterator histogram_even(my_system &system, InputIterator, InputIterator, RandomAccessIterator histogram, Size, T, T)
+{
+  system.validate_dispatch();
+  return histogram;
+}
+
+void TestHistogramEvenDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::histogram_even(sys, vec.begin(), vec.begin(), vec.begin(), 1, 0, 1);
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchExplicit);
+
+
+template<typename InputIterator, typename RandomAccessIterator, typename Size, typename T>
+RandomAccessIterator histogram_even(my_tag, InputIterator, InputIterator, RandomAccessIterator histogram, Size, T, T)
+{
+  *histogram = 13;
+  return histogram;
+}
+
+void TestHistogramEvenDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::histogram_even(thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()),
+                         1, 0, 1);
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestHistogramEvenDispatchImplicit);
+
+
+template<typename InputIterator, typename RandomAccessIterator1, typename RandomAccessIterator2>
+RandomAccessIterator2 histogram_range(my_system &system, InputIterator, InputIterator, RandomAccessIterator1, RandomAccessIterator1, RandomAccessIterator2 histogram)
+{
+  system.validate_dispatch();
+  return histogram;
+}
+
+void TestHistogramRangeDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::histogram_range(sys, vec.begin(), vec.begin(), vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestHistogramRangeDispatchExplicit);
+
+
+template<typename Vector>
+void TestHistogramEvenSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector samples(8);
+  samples[0] = 0; samples[1] = 3; samples[2] = 4; samples[3] = 9; samples[4] = 15; samples[5] = 16; samples[6] = 17; samples[7] = 7;
+
+  Vector histogram(4, T(-1));
+
+  typename Vector::iterator end = thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 4, T(0), T(16));
+
+  ASSERT_EQUAL_QUIET(histogram.end(), end);
+  ASSERT_EQUAL(2, histogram[0]);
+  ASSERT_EQUAL(2, histogram[1]);
+  ASSERT_EQUAL(1, histogram[2]);
+  ASSERT_EQUAL(1, histogram[3]);
+
+  // no bins
+  end = thrust::histogram_even(samples.begin(), samples.end(), histogram.begin(), 0, T(0), T(16));
+
+  ASSERT_EQUAL_QUIET(histogram.begin(), end);
+}
+DECLARE_VECTOR_UNITTEST(TestHistogramEvenSimple);
+
+
+template<typename Vector>
+void TestHistogramRangeSimple(void)
+{
+  typedef typename Vector::value_type T;
+
+  Vector samples(8);
+  samples[0] = 0; samples[1] = 3; samples[2] = 4; samples[3] = 9; samples[4] = 15; samples[5] = 16; samples[6] = 17; samples[7] = 7;
+
+  Vector levels(4);
+  levels[0] = 1; levels[1] = 4; levels[2] = 8; levels[3] = 16;
+
+  Vector histogram(3, T(-1));
+
+  typename Vector::iterator end = thrust::histogram_range(samples.begin(), samples.end(), levels.begin(), levels.end(), histogram.begin());
+
+  ASSERT_EQUAL_QUIET(histogram.end(), end);
+  ASSERT_EQUAL(1, histogram[0]);
+  ASSERT_EQUAL(2, histogram[1]);
+  ASSERT_EQUAL(2, histogram[2]);
+
+  // a single level delimits no bins
+  end = thrust::histogram_range(samples.begin(), samples.end(), levels.begin(), levels.begin() + 1, histogram.begin());
+
+  ASSERT_EQUAL_QUIET(histogram.begin(), end);
+}
+DECLARE_VECTOR_UNITTEST(TestHistogramRangeSimple);
+
+
+template<typename T>
+struct TestHistogramEven
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_samples = unittest::random_integers<T>(n);
+
+    for(size_t i = 0; i < n; ++i)
+    {
+      h_samples[i] = static_cast<T>(h_samples[i] & 127);
+    }
+
+    thrust::device_vector<T> d_samples = h_samples;
+
+    // [10, 110) in 7 bins, which are not all of the same width
+    thrust::host_vector<long long> h_reference(7, 0);
+
+    for(size_t i = 0; i < n; ++i)
+    {
+      const long long x = h_samples[i];
+
+      if(10 <= x && x < 110)
+      {
+        h_reference[(x - 10) * 7 / 100]++;
+      }
+    }
+
+    thrust::host_vector<long long>   h_histogram(7);
+    thrust::device_vector<long long> d_histogram(7);
+
+    thrust::histogram_even(h_samples.begin(), h_samples.end(), h_histogram.begin(), 7, T(10), T(110));
+    thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), 7, T(10), T(110));
+
+    ASSERT_EQUAL(h_reference, h_histogram);
+    ASSERT_EQUAL(h_reference, d_histogram);
+  }
+};
+VariableUnitTest<TestHistogramEven, IntegralTypes> TestHistogramEvenInstance;
+
+
+template<typename T>
+struct TestHistogramRange
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_samples = unittest::random_integers<T>(n);
+
+    for(size_t i = 0; i < n; ++i)
+    {
+      h_samples[i] = static_cast<T>(h_samples[i] & 127);
+    }
+
+    thrust::device_vector<T> d_samples = h_samples;
+
+    const T levels[7] = {0, 3, 10, 11, 50, 100, 127};
+
+    thrust::host_vector<T>   h_levels(levels, levels + 7);
+    thrust::device_vector<T> d_levels = h_levels;
+
+    thrust::host_vector<int> h_reference(6, 0);
+
+    for(size_t i = 0; i < n; ++i)
+    {
+      for(int b = 0; b < 6; ++b)
+      {
+        if(levels[b] <= h_samples[i] && h_samples[i] < levels[b + 1])
+        {
+          h_reference[b]++;
+        }
+      }
+    }
+
+    thrust::host_vector<int>   h_histogram(6);
+    thrust::device_vector<int> d_histogram(6);
+
+    thrust::histogram_range(h_samples.begin(), h_samples.end(), h_levels.begin(), h_levels.end(), h_histogram.begin());
+    thrust::histogram_range(d_samples.begin(), d_samples.end(), d_levels.begin(), d_levels.end(), d_histogram.begin());
+
+    ASSERT_EQUAL(h_reference, h_histogram);
+    ASSERT_EQUAL(h_reference, d_histogram);
+  }
+};
+VariableUnitTest<TestHistogramRange, IntegralTypes> TestHistogramRangeInstance;
+
+
+void TestHistogramEvenFloat(void)
+{
+  const size_t n = (1 << 20) + 3;
+
+  thrust::host_vector<float> h_samples = unittest::random_samples<float>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_samples[i] = h_samples[i] - std::floor(h_samples[i]);
+  }
+
+  h_samples[0] = 0.25f;
+  h_samples[1] = 0.75f;
+  h_samples[2] = std::numeric_limits<float>::quiet_NaN();
+
+  thrust::device_vector<float> d_samples = h_samples;
+
+  // bins of width 1/16 over [0.25, 0.75), in which the bins are computed exactly
+  thrust::host_vector<size_t> h_reference(8, 0);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    const double x = h_samples[i];
+
+    if(0.25 <= x && x < 0.75)
+    {
+      h_reference[static_cast<size_t>((x - 0.25) * 16)]++;
+    }
+  }
+
+  thrust::device_vector<size_t> d_histogram(8);
+
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), 8, 0.25f, 0.75f);
+
+  ASSERT_EQUAL(h_reference, d_histogram);
+}
+DECLARE_UNITTEST(TestHistogramEvenFloat);
+
+
+void TestHistogramEvenManyBins(void)
+{
+  // more bins than samples per processor
+  const int n = 100000;
+
+  thrust::counting_iterator<int> first(0);
+
+  thrust::device_vector<int> d_histogram(n / 2);
+
+  thrust::histogram_even(first, first + n, d_histogram.begin(), n / 2, 0, n);
+
+  ASSERT_EQUAL(thrust::device_vector<int>(n / 2, 2), d_histogram);
+}
+DECLARE_UNITTEST(TestHistogramEvenManyBins);
+
+
+void TestHistogramEvenWideRange(void)
+{
+  // the offset of a sample times the number of bins exceeds 64 bits
+  const long long lower    = -9000000000000000000ll;
+  const long long upper    =  9000000000000000000ll;
+  const int       num_bins = 1000;
+  const long long width    = 18000000000000000ll;
+
+  // the first and last sample of each bin
+  thrust::host_vector<long long> h_samples;
+
+  // accumulate the bin boundaries, as k * width would overflow
+  long long bin_lower = lower;
+
+  for(int k = 0; k < num_bins; ++k)
+  {
+    h_samples.push_back(bin_lower);
+    h_samples.push_back(bin_lower + (width - 1));
+
+    if(k + 1 < num_bins) bin_lower += width;
+  }
+
+  thrust::device_vector<long long> d_samples = h_samples;
+  thrust::device_vector<int> d_histogram(num_bins);
+
+  thrust::histogram_even(d_samples.begin(), d_samples.end(), d_histogram.begin(), num_bins, lower, upper);
+
+  ASSERT_EQUAL(thrust::device_vector<int>(num_bins, 2), d_histogram);
+}
+DECLARE_UNITTEST(TestHistogramEvenWideRange);
+
@@ -73,6 +73,60 @@ void TestMinMaxElement(const size_t n)
 DECLARE_VARIABLE_UNITTEST(TestMinMaxElement);
 
 
+template<typename T>
+void TestMinMaxElementLargeWithTies(void)
+{
+    // large enough for the parallel backends to split the range, with each
+    // extremum repeated across tiles and within a block
+    const size_t n = (1 << 18) + 17;
+
+    thrust::host_vector<T> h_data(n);
+
+    for(size_t i = 0; i < n; ++i)
+    {
+        h_data[i] = T(10 + (i * 7919) % 1000);
+    }
+
+    size_t min_positions[] = {n - 10, n / 2 + 1, 2005, 2000};
+    size_t max_positions[] = {n - 1, n / 3, 1503, 1500};
+
+    for(int p = 0; p < 4; ++p)
+    {
+        h_data[min_positions[p]] = T(0);
+        h_data[max_positions[p]] = T(5000);
+    }
+
+    thrust::device_vector<T> d_data = h_data;
+
+    ASSERT_EQUAL(2000, thrust::min_element(d_data.begin(), d_data.end()) - d_data.begin());
+    ASSERT_EQUAL(1500, thrust::max_element(d_data.begin(), d_data.end()) - d_data.begin());
+    ASSERT_EQUAL(2000, thrust::minmax_element(d_data.begin(), d_data.end()).first  - d_data.begin());
+    ASSERT_EQUAL(1500, thrust::minmax_element(d_data.begin(), d_data.end()).second - d_data.begin());
+
+    // the first element is an extremum
+    d_data[0] = T(5000);
+
+    ASSERT_EQUAL(0, thrust::max_element(d_data.begin(), d_data.end()) - d_data.begin());
+    ASSERT_EQUAL(0, thrust::minmax_element(d_data.begin(), d_data.end()).second - d_data.begin());
+
+    // a subrange which does not begin on a block boundary
+    ASSERT_EQUAL(n / 2 + 1, thrust::min_element(d_data.begin() + 2006, d_data.end()) - d_data.begin());
+    ASSERT_EQUAL(n / 3,     thrust::max_element(d_data.begin() + 1504, d_data.end()) - d_data.begin());
+}
+
+void TestMinMaxElementLargeWithTiesInt(void)
+{
+    TestMinMaxElementLargeWithTies<int>();
+}
+DECLARE_UNITTEST(TestMinMaxElementLargeWithTiesInt);
+
+void TestMinMaxElementLargeWithTiesFloat(void)
+{
+    TestMinMaxElementLargeWithTies<float>();
+}
+DECLARE_UNITTEST(TestMinMaxElementLargeWithTiesFloat);
+
+
 template<typename ForwardIterator>
 thrust::pair<ForwardIterator,ForwardIterator> minmax_element(my_system &system, ForwardIterator first, ForwardIterator)
 {
@@ -0,0 +1,75 @@
+#include <unittest/unittest.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/reduce.h>
+#include <thrust/count.h>
+#include <thrust/host_vector.h>
+
+#if (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP) || (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB)
+
+#if (THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP)
+#include <thrust/system/omp/vector.h>
+namespace numa_system = thrust::system::omp;
+#else
+#include <thrust/system/tbb/vector.h>
+namespace numa_system = thrust::system::tbb;
+#endif
+
+
+template<typename T>
+  struct numa_vector
+{
+  typedef numa_system::vector<T, numa_system::numa_allocator<T> > type;
+};
+
+
+template<typename T>
+void TestNumaAllocatorFill(const size_t n)
+{
+  typename numa_vector<T>::type v(n, T(7));
+
+  ASSERT_EQUAL(n, v.size());
+  ASSERT_EQUAL(true, thrust::count(v.begin(), v.end(), T(7)) == static_cast<ptrdiff_t>(n));
+
+  // growing past the capacity moves the elements into new storage
+  v.resize(2 * n + 1, T(13));
+
+  ASSERT_EQUAL(true, thrust::count(v.begin(), v.begin() + n, T(7)) == static_cast<ptrdiff_t>(n));
+  ASSERT_EQUAL(true, thrust::count(v.begin() + n, v.end(), T(13)) == static_cast<ptrdiff_t>(n + 1));
+}
+DECLARE_VARIABLE_UNITTEST(TestNumaAllocatorFill);
+
+
+template<typename T>
+void TestNumaAllocatorCopy(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  typename numa_vector<T>::type v(h_data.begin(), h_data.end());
+
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(v.begin(), v.end()));
+
+  thrust::sort(h_data.begin(), h_data.end());
+  thrust::sort(v.begin(), v.end());
+
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(v.begin(), v.end()));
+}
+DECLARE_VARIABLE_UNITTEST(TestNumaAllocatorCopy);
+
+
+void TestNumaAllocatorLarge()
+{
+  // large enough to be mapped directly from the operating system
+  const size_t n = 1 << 20;
+
+  numa_vector<int>::type v(n);
+
+  thrust::sequence(v.begin(), v.end());
+
+  ASSERT_EQUAL(0, v.front());
+  ASSERT_EQUAL(int(n - 1), v.back());
+  ASSERT_EQUAL(true, thrust::reduce(v.begin(), v.end(), 0ll) == (long long)n * (n - 1) / 2);
+}
+DECLARE_UNITTEST(TestNumaAllocatorLarge);
+
+#endif
@@ -0,0 +1,50 @@
+#include <unittest/unittest.h>
+#include <thrust/system/cpp/memory.h>
+#include <thrust/system/cpp/vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/reduce.h>
+#include <thrust/transform.h>
+#include <thrust/functional.h>
+
+
+template<typename T>
+void TestPageLockedAllocator(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::host_vector<T, thrust::cpp::page_locked_allocator<T> > h(h_data.begin(), h_data.end());
+
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(h.begin(), h.end()));
+
+  thrust::cpp::vector<T, thrust::cpp::page_locked_allocator<T> > v(n);
+
+  thrust::transform(h.begin(), h.end(), v.begin(), thrust::negate<T>());
+  thrust::transform(h_data.begin(), h_data.end(), h_data.begin(), thrust::negate<T>());
+
+  ASSERT_EQUAL(h_data, thrust::host_vector<T>(v.begin(), v.end()));
+}
+DECLARE_VARIABLE_UNITTEST(TestPageLockedAllocator);
+
+
+void TestPageLockedAllocatorLarge()
+{
+  // large enough to be mapped and locked
+  const size_t n = 1 << 20;
+
+  thrust::cpp::vector<int, thrust::cpp::page_locked_allocator<int> > v(n);
+
+  thrust::sequence(v.begin(), v.end());
+
+  ASSERT_EQUAL(0, v.front());
+  ASSERT_EQUAL(int(n - 1), v.back());
+  ASSERT_EQUAL(true, thrust::reduce(v.begin(), v.end(), 0ll) == (long long)n * (n - 1) / 2);
+
+  // growing moves the elements into new storage
+  v.resize(2 * n, 13);
+
+  ASSERT_EQUAL(int(n - 1), v[n - 1]);
+  ASSERT_EQUAL(13, v.back());
+}
+DECLARE_UNITTEST(TestPageLockedAllocatorLarge);
+
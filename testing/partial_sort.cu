@@ -0,0 +1,330 @@
+#include <unittest/unittest.h>
+#include <thrust/partial_sort.h>
+#include <thrust/sort.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/retag.h>
+
+
+template<typename RandomAccessIterator>
+void nth_element(my_system &system, RandomAccessIterator, RandomAccessIterator, RandomAccessIterator)
+{
+  system.validate_dispatch();
+}
+
+void TestNthElementDispatchExplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  my_system sys(0);
+  thrust::nth_element(sys, vec.begin(), vec.begin(), vec.begin());
+
+  ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestNthElementDispatchExplicit);
+
+
+template<typename RandomAccessIterator>
+void nth_element(my_tag, RandomAccessIterator first, RandomAccessIterator, RandomAccessIterator)
+{
+  *first = 13;
+}
+
+void TestNthElementDispatchImplicit()
+{
+  thrust::device_vector<int> vec(1);
+
+  thrust::nth_element(thrust::retag<my_tag>(vec.begin()),
+                      thrust::retag<my_tag>(vec.begin()),
+                      thrust::retag<my_tag>(vec.begin()));
+
+  ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestNthElementDispatchImplicit);
+
+
+template<typename Vector>
+void TestNthElementSimple(void)
+{
+  Vector data(7);
+  data[0] = 1; data[1] = 3; data[2] = 6; data[3] = 5; data[4] = 2; data[5] = 0; data[6] = 4;
+
+  thrust::nth_element(data.begin(), data.begin() + 2, data.end());
+
+  ASSERT_EQUAL(2, data[2]);
+
+  thrust::sort(data.begin(), data.begin() + 2);
+  thrust::sort(data.begin() + 3, data.end());
+
+  ASSERT_EQUAL(0, data[0]);
+  ASSERT_EQUAL(1, data[1]);
+  ASSERT_EQUAL(3, data[3]);
+  ASSERT_EQUAL(6, data[6]);
+}
+DECLARE_VECTOR_UNITTEST(TestNthElementSimple);
+
+
+// checks that data is partitioned about data[nth], which is sorted[nth]
+template<typename T, typename Compare>
+void check_nth_element(const thrust::host_vector<T> &data, const thrust::host_vector<T> &sorted, size_t nth, Compare comp)
+{
+  ASSERT_EQUAL(sorted[nth], data[nth]);
+
+  bool partitioned = true;
+
+  for(size_t i = 0; i < nth; ++i)
+  {
+    partitioned = partitioned && !comp(data[nth], data[i]);
+  }
+
+  for(size_t i = nth + 1; i < data.size(); ++i)
+  {
+    partitioned = partitioned && !comp(data[i], data[nth]);
+  }
+
+  ASSERT_EQUAL(true, partitioned);
+}
+
+
+template<typename T>
+void TestNthElement(const size_t n)
+{
+  if(n == 0) return;
+
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_sorted = h_data;
+  thrust::sort(h_sorted.begin(), h_sorted.end());
+
+  size_t positions[] = {0, n / 3, n / 2, n - 1};
+
+  for(int p = 0; p < 4; ++p)
+  {
+    thrust::device_vector<T> d_data = h_data;
+
+    thrust::nth_element(d_data.begin(), d_data.begin() + positions[p], d_data.end());
+
+    check_nth_element(thrust::host_vector<T>(d_data), h_sorted, positions[p], thrust::less<T>());
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestNthElement);
+
+
+struct mod_1000_less
+{
+  __host__ __device__
+  bool operator()(int x, int y) const
+  {
+    return (x % 1000) < (y % 1000);
+  }
+};
+
+
+void TestNthElementLarge(void)
+{
+  // large enough for the parallel backends to partition in parallel
+  const size_t n = (1 << 18) + 17;
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(n);
+
+  for(size_t i = 0; i < n; ++i)
+  {
+    h_data[i] = h_data[i] >= 0 ? h_data[i] : -(h_data[i] + 1);
+  }
+
+  size_t positions[] = {0, 100, n / 2, n - 100, n - 1};
+
+  for(int p = 0; p < 5; ++p)
+  {
+    // radix select
+    thrust::host_vector<int> h_sorted = h_data;
+    thrust::sort(h_sorted.begin(), h_sorted.end(), thrust::greater<int>());
+
+    thrust::device_vector<int> d_data = h_data;
+    thrust::nth_element(d_data.begin(), d_data.begin() + positions[p], d_data.end(), thrust::greater<int>());
+
+    check_nth_element(thrust::host_vector<int>(d_data), h_sorted, positions[p], thrust::greater<int>());
+
+    // sample select, with many equivalent elements
+    h_sorted = h_data;
+    thrust::stable_sort(h_sorted.begin(), h_sorted.end(), mod_1000_less());
+
+    d_data = h_data;
+    thrust::nth_element(d_data.begin(), d_data.begin() + positions[p], d_data.end(), mod_1000_less());
+
+    thrust::host_vector<int> h_result = d_data;
+
+    // the elements are a permutation of the input
+    thrust::host_vector<int> h_permutation = h_result;
+    thrust::sort(h_permutation.begin(), h_permutation.end());
+
+    thrust::host_vector<int> h_expected = h_data;
+    thrust::sort(h_expected.begin(), h_expected.end());
+
+    ASSERT_EQUAL(h_expected, h_permutation);
+
+    // nth is equivalent to, but may differ from, the stably sorted element
+    ASSERT_EQUAL(h_sorted[positions[p]] % 1000, h_result[positions[p]] % 1000);
+
+    h_result[positions[p]] = h_sorted[positions[p]];
+
+    check_nth_element(h_result, h_sorted, positions[p], mod_1000_less());
+  }
+}
+DECLARE_UNITTEST(TestNthElementLarge);
+
+
+template<typename Vector>
+void TestPartialSortSimple(void)
+{
+  Vector data(7);
+  data[0] = 1; data[1] = 3; data[2] = 6; data[3] = 5; data[4] = 2; data[5] = 0; data[6] = 4;
+
+  thrust::partial_sort(data.begin(), data.begin() + 3, data.end());
+
+  ASSERT_EQUAL(0, data[0]);
+  ASSERT_EQUAL(1, data[1]);
+  ASSERT_EQUAL(2, data[2]);
+
+  thrust::partial_sort(data.begin(), data.begin() + 2, data.end(), thrust::greater<int>());
+
+  ASSERT_EQUAL(6, data[0]);
+  ASSERT_EQUAL(5, data[1]);
+}
+DECLARE_VECTOR_UNITTEST(TestPartialSortSimple);
+
+
+template<typename T>
+void TestPartialSort(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_sorted = h_data;
+  thrust::sort(h_sorted.begin(), h_sorted.end());
+
+  size_t middles[] = {0, 1, n / 10, n};
+
+  for(int p = 0; p < 4; ++p)
+  {
+    const size_t m = thrust::min(middles[p], n);
+
+    thrust::device_vector<T> d_data = h_data;
+
+    thrust::partial_sort(d_data.begin(), d_data.begin() + m, d_data.end());
+
+    thrust::host_vector<T> h_result = d_data;
+
+    ASSERT_EQUAL(thrust::host_vector<T>(h_sorted.begin(), h_sorted.begin() + m),
+                 thrust::host_vector<T>(h_result.begin(), h_result.begin() + m));
+
+    thrust::sort(h_result.begin(), h_result.end());
+
+    ASSERT_EQUAL(h_sorted, h_result);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestPartialSort);
+
+
+template<typename T>
+void TestPartialSortCopy(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_sorted = h_data;
+  thrust::sort(h_sorted.begin(), h_sorted.end());
+
+  size_t sizes[] = {0, 3, n / 10, n, n + 5};
+
+  for(int p = 0; p < 5; ++p)
+  {
+    const size_t m = thrust::min(sizes[p], n);
+
+    thrust::device_vector<T> d_data = h_data;
+    thrust::device_vector<T> d_result(sizes[p]);
+
+    typename thrust::device_vector<T>::iterator end =
+      thrust::partial_sort_copy(d_data.begin(), d_data.end(), d_result.begin(), d_result.end());
+
+    ASSERT_EQUAL_QUIET(d_result.begin() + m, end);
+    ASSERT_EQUAL(thrust::host_vector<T>(h_sorted.begin(), h_sorted.begin() + m),
+                 thrust::host_vector<T>(d_result.begin(), d_result.begin() + m));
+
+    // the input is unchanged
+    ASSERT_EQUAL(h_data, d_data);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestPartialSortCopy);
+
+
+void TestTopK(void)
+{
+  const size_t n = (1 << 18) + 17;
+
+  thrust::host_vector<float> h_data = unittest::random_samples<float>(n);
+  thrust::host_vector<float> h_sorted = h_data;
+  thrust::sort(h_sorted.begin(), h_sorted.end(), thrust::greater<float>());
+
+  thrust::device_vector<float> d_data = h_data;
+
+  // small k keeps a heap per thread, large k selects from a copy
+  size_t ks[] = {1, 10, 1000, n / 2, n + 1};
+
+  for(int p = 0; p < 5; ++p)
+  {
+    const size_t m = thrust::min(ks[p], n);
+
+    thrust::device_vector<float> d_result(m);
+
+    thrust::device_vector<float>::iterator end =
+      thrust::top_k(d_data.begin(), d_data.end(), ks[p], d_result.begin());
+
+    ASSERT_EQUAL_QUIET(d_result.end(), end);
+    ASSERT_EQUAL(thrust::host_vector<float>(h_sorted.begin(), h_sorted.begin() + m), d_result);
+
+    // the smallest with less
+    thrust::top_k(d_data.begin(), d_data.end(), ks[p], d_result.begin(), thrust::less<float>());
+
+    ASSERT_EQUAL(thrust::host_vector<float>(h_sorted.rbegin(), h_sorted.rbegin() + m), d_result);
+  }
+}
+DECLARE_UNITTEST(TestTopK);
+
+
+void TestTopKByKey(void)
+{
+  // distinct keys, so that the selected values are determined
+  const int n = 1 << 17;
+
+  thrust::host_vector<int> h_keys(n), h_values(n);
+
+  for(int i = 0; i < n; ++i)
+  {
+    h_keys[i]   = (i * 7919) % n;
+    h_values[i] = i;
+  }
+
+  thrust::device_vector<int> d_keys = h_keys;
+  thrust::device_vector<int> d_values = h_values;
+
+  int ks[] = {5, 500, n / 4};
+
+  for(int p = 0; p < 3; ++p)
+  {
+    const int k = ks[p];
+
+    thrust::device_vector<int> d_keys_result(k), d_values_result(k);
+
+    thrust::top_k_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), k, d_keys_result.begin(), d_values_result.begin());
+
+    thrust::host_vector<int> h_keys_result = d_keys_result;
+    thrust::host_vector<int> h_values_result = d_values_result;
+
+    bool correct = true;
+
+    for(int i = 0; i < k; ++i)
+    {
+      correct = correct && h_keys_result[i] == n - 1 - i;
+      correct = correct && h_keys[h_values_result[i]] == h_keys_result[i];
+    }
+
+    ASSERT_EQUAL(true, correct);
+  }
+}
+DECLARE_UNITTEST(TestTopKByKey);
+
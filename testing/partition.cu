@@ -5,6 +5,9 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/sort.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+#include <thrust/functional.h>
 
 template<typename T>
 struct is_even
@@ -724,6 +727,102 @@ struct TestStablePartitionStencil
 VariableUnitTest<TestStablePartitionStencil, PartitionTypes> TestStablePartitionStencilInstance;
 
 
+// selects the elements of a sequence in several patterns which exercise
+// the parallel partitions' placement of tiles
+struct partition_pattern
+{
+    int pattern;
+    int n;
+
+    partition_pattern(int pattern, int n) : pattern(pattern), n(n) {}
+
+    __host__ __device__
+    bool operator()(int x) const
+    {
+        switch(pattern)
+        {
+            case 0:  return x < n / 2;      // already partitioned
+            case 1:  return x >= n / 2;     // every element misplaced
+            case 2:  return x % 1000 != 0;  // few false elements
+            case 3:  return x % 1000 == 0;  // few true elements
+            default: return x % 3 == 0;
+        }
+    }
+};
+
+
+void TestPartitionLarge(void)
+{
+    // large enough for the parallel backends to split into many tiles
+    const int n = (1 << 18) + 17;
+
+    thrust::host_vector<int> h_data(n);
+    thrust::sequence(h_data.begin(), h_data.end());
+
+    for(int pattern = 0; pattern < 5; ++pattern)
+    {
+        partition_pattern pred(pattern, n);
+
+        thrust::device_vector<int> d_data = h_data;
+
+        thrust::device_vector<int>::iterator d_iter = thrust::partition(d_data.begin(), d_data.end(), pred);
+
+        ASSERT_EQUAL(thrust::count_if(h_data.begin(), h_data.end(), pred), d_iter - d_data.begin());
+        ASSERT_EQUAL(true, thrust::is_partitioned(d_data.begin(), d_data.end(), pred));
+
+        thrust::sort(d_data.begin(), d_data.end());
+
+        ASSERT_EQUAL(h_data, d_data);
+
+        // with the elements themselves as the stencil
+        thrust::device_vector<int> d_stencil = h_data;
+        d_data = h_data;
+
+        d_iter = thrust::partition(d_data.begin(), d_data.end(), d_stencil.begin(), pred);
+
+        ASSERT_EQUAL(true, thrust::is_partitioned(d_data.begin(), d_data.end(), pred));
+        ASSERT_EQUAL(thrust::count_if(h_data.begin(), h_data.end(), pred), d_iter - d_data.begin());
+    }
+}
+DECLARE_UNITTEST(TestPartitionLarge);
+
+
+void TestStablePartitionLarge(void)
+{
+    const int n = (1 << 18) + 17;
+
+    thrust::host_vector<int> h_data(n);
+    thrust::sequence(h_data.begin(), h_data.end());
+
+    for(int pattern = 0; pattern < 5; ++pattern)
+    {
+        partition_pattern pred(pattern, n);
+
+        thrust::host_vector<int> h_result = h_data;
+        thrust::host_vector<int>::iterator h_iter = thrust::stable_partition(h_result.begin(), h_result.end(), pred);
+
+        thrust::device_vector<int> d_data = h_data;
+        thrust::device_vector<int>::iterator d_iter = thrust::stable_partition(d_data.begin(), d_data.end(), pred);
+
+        ASSERT_EQUAL(h_result, d_data);
+        ASSERT_EQUAL(h_iter - h_result.begin(), d_iter - d_data.begin());
+
+        // partition the stencil's negation by a stencil
+        thrust::device_vector<int> d_stencil = h_data;
+        thrust::device_vector<int> d_values(n);
+        thrust::transform(d_stencil.begin(), d_stencil.end(), d_values.begin(), thrust::negate<int>());
+
+        d_iter = thrust::stable_partition(d_values.begin(), d_values.end(), d_stencil.begin(), pred);
+
+        thrust::transform(d_values.begin(), d_values.end(), d_values.begin(), thrust::negate<int>());
+
+        ASSERT_EQUAL(h_result, d_values);
+        ASSERT_EQUAL(h_iter - h_result.begin(), d_iter - d_values.begin());
+    }
+}
+DECLARE_UNITTEST(TestStablePartitionLarge);
+
+
 template <typename T>
 struct TestStablePartitionCopy
 {
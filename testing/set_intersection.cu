@@ -251,3 +251,47 @@ void TestSetIntersectionMultiset(const size_t n)
 }
 DECLARE_VARIABLE_UNITTEST(TestSetIntersectionMultiset);
 
+
+void TestSetIntersectionLarge(void)
+{
+  // large enough to be split among the processors, with runs of equivalent
+  // elements long enough to cross the splits
+  const size_t n1 = (1 << 17) + 13;
+  const size_t n2 = (1 << 16) + 7;
+
+  thrust::host_vector<int> h_a = unittest::random_integers<unittest::int8_t>(n1);
+  thrust::host_vector<int> h_b = unittest::random_integers<unittest::int8_t>(n2);
+
+  thrust::stable_sort(h_a.begin(), h_a.end());
+  thrust::stable_sort(h_b.begin(), h_b.end());
+
+  thrust::device_vector<int> d_a = h_a;
+  thrust::device_vector<int> d_b = h_b;
+
+  thrust::host_vector<int>   h_result(n1 + n2);
+  thrust::device_vector<int> d_result(n1 + n2);
+
+  thrust::host_vector<int>::iterator h_end =
+    thrust::set_intersection(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+  h_result.resize(h_end - h_result.begin());
+
+  thrust::device_vector<int>::iterator d_end =
+    thrust::set_intersection(d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin());
+  d_result.resize(d_end - d_result.begin());
+
+  ASSERT_EQUAL(h_result, d_result);
+
+  // the second input first
+  h_result.resize(n1 + n2);
+  d_result.resize(n1 + n2);
+
+  h_end = thrust::set_intersection(h_b.begin(), h_b.end(), h_a.begin(), h_a.end(), h_result.begin());
+  h_result.resize(h_end - h_result.begin());
+
+  d_end = thrust::set_intersection(d_b.begin(), d_b.end(), d_a.begin(), d_a.end(), d_result.begin());
+  d_result.resize(d_end - d_result.begin());
+
+  ASSERT_EQUAL(h_result, d_result);
+}
+DECLARE_UNITTEST(TestSetIntersectionLarge);
+
@@ -0,0 +1,171 @@
+#include <unittest/unittest.h>
+#include <thrust/small_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <vector>
+
+
+template<typename Vector>
+thrust::host_vector<typename Vector::value_type> to_host(const Vector &v)
+{
+  return thrust::host_vector<typename Vector::value_type>(v.begin(), v.end());
+}
+
+
+template<typename Vector>
+bool is_inline(const Vector &v)
+{
+  const char *first = reinterpret_cast<const char*>(&v);
+  const char *data  = reinterpret_cast<const char*>(thrust::raw_pointer_cast(v.data()));
+
+  return first <= data && data < first + sizeof(Vector);
+}
+
+
+void TestSmallVectorInline()
+{
+  thrust::small_vector<int, 4> v;
+
+  ASSERT_EQUAL(0u, v.size());
+  ASSERT_EQUAL(4u, v.capacity());
+  ASSERT_EQUAL(true, is_inline(v));
+
+  for(int i = 0; i < 4; ++i) v.push_back(i);
+
+  ASSERT_EQUAL(true, is_inline(v));
+  ASSERT_EQUAL(4u, v.capacity());
+
+  // the fifth element moves the elements to the heap
+  v.push_back(4);
+
+  ASSERT_EQUAL(false, is_inline(v));
+  ASSERT_EQUAL(true, v.capacity() >= 5u);
+
+  for(int i = 0; i < 5; ++i) ASSERT_EQUAL(i, v[i]);
+
+  // shrinking returns to the buffer
+  v.resize(2);
+  v.shrink_to_fit();
+
+  ASSERT_EQUAL(true, is_inline(v));
+  ASSERT_EQUAL(2u, v.size());
+  ASSERT_EQUAL(0, v[0]);
+  ASSERT_EQUAL(1, v[1]);
+
+  v.clear();
+  v.shrink_to_fit();
+
+  ASSERT_EQUAL(true, is_inline(v));
+  ASSERT_EQUAL(4u, v.capacity());
+}
+DECLARE_UNITTEST(TestSmallVectorInline);
+
+
+void TestSmallVectorCopyAndSwap()
+{
+  thrust::small_vector<int, 3> a(2, 7);
+  thrust::small_vector<int, 3> b(10);
+  thrust::sequence(b.begin(), b.end());
+
+  thrust::small_vector<int, 3> c(b);
+  ASSERT_EQUAL(to_host(b), to_host(c));
+
+  a.swap(b);
+
+  ASSERT_EQUAL(10u, a.size());
+  ASSERT_EQUAL(2u, b.size());
+  ASSERT_EQUAL(true, is_inline(b));
+  ASSERT_EQUAL(7, b[0]);
+  ASSERT_EQUAL(7, b[1]);
+  ASSERT_EQUAL(to_host(c), to_host(a));
+
+  // both inline
+  thrust::small_vector<int, 3> d(1, 13);
+  b.swap(d);
+
+  ASSERT_EQUAL(1u, b.size());
+  ASSERT_EQUAL(13, b[0]);
+  ASSERT_EQUAL(2u, d.size());
+  ASSERT_EQUAL(7, d[1]);
+
+  thrust::host_vector<int> h(5, 3);
+  d = h;
+  ASSERT_EQUAL(h, to_host(d));
+
+  std::vector<int> s(2, 4);
+  thrust::small_vector<int, 3> e(s);
+  ASSERT_EQUAL(true, is_inline(e));
+  ASSERT_EQUAL(thrust::host_vector<int>(s), to_host(e));
+}
+DECLARE_UNITTEST(TestSmallVectorCopyAndSwap);
+
+
+template<typename T>
+void TestSmallVectorAlgorithms(const size_t n)
+{
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+
+  thrust::small_vector<T, 16> v(h_data.begin(), h_data.end());
+
+  thrust::sort(h_data.begin(), h_data.end());
+  thrust::sort(v.begin(), v.end());
+
+  ASSERT_EQUAL(h_data, to_host(v));
+
+  v.insert(v.begin(), 3, T(1));
+  v.erase(v.begin(), v.begin() + 3);
+
+  ASSERT_EQUAL(h_data, to_host(v));
+}
+DECLARE_VARIABLE_UNITTEST(TestSmallVectorAlgorithms);
+
+
+template<typename T>
+  struct slow_growth_allocator
+    : std::allocator<T>
+{
+  template<typename U>
+    struct rebind
+  {
+    typedef slow_growth_allocator<U> other;
+  };
+};
+
+namespace thrust
+{
+
+template<typename T>
+  struct vector_growth_factor<slow_growth_allocator<T> >
+{
+  static const std::size_t numerator   = 5;
+  static const std::size_t denominator = 4;
+};
+
+}
+
+
+void TestVectorGrowthFactor()
+{
+  thrust::host_vector<int> doubling(100);
+  thrust::host_vector<int, slow_growth_allocator<int> > slow(100);
+
+  doubling.push_back(0);
+  slow.push_back(0);
+
+  ASSERT_EQUAL(200u, doubling.capacity());
+  ASSERT_EQUAL(125u, slow.capacity());
+
+  // growth never yields less than is required
+  slow.insert(slow.end(), 100, 1);
+
+  ASSERT_EQUAL(201u, slow.size());
+  ASSERT_EQUAL(201u, slow.capacity());
+
+  thrust::small_vector<int, 4, slow_growth_allocator<int> > small(100);
+  small.push_back(0);
+
+  ASSERT_EQUAL(125u, small.capacity());
+}
+DECLARE_UNITTEST(TestVectorGrowthFactor);
+
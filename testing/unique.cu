@@ -95,6 +95,50 @@ void TestUniqueCopyDispatchImplicit()
 DECLARE_UNITTEST(TestUniqueCopyDispatchImplicit);
 
 
+template <typename ForwardIterator>
+typename thrust::iterator_difference<ForwardIterator>::type
+  unique_count(my_system &system,
+               ForwardIterator,
+               ForwardIterator)
+{
+    system.validate_dispatch();
+    return 0;
+}
+
+void TestUniqueCountDispatchExplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    my_system sys(0);
+    thrust::unique_count(sys, vec.begin(), vec.begin());
+
+    ASSERT_EQUAL(true, sys.is_valid());
+}
+DECLARE_UNITTEST(TestUniqueCountDispatchExplicit);
+
+
+template <typename ForwardIterator>
+typename thrust::iterator_difference<ForwardIterator>::type
+  unique_count(my_tag,
+               ForwardIterator first,
+               ForwardIterator)
+{
+    *first = 13;
+    return 0;
+}
+
+void TestUniqueCountDispatchImplicit()
+{
+    thrust::device_vector<int> vec(1);
+
+    thrust::unique_count(thrust::retag<my_tag>(vec.begin()),
+                         thrust::retag<my_tag>(vec.begin()));
+
+    ASSERT_EQUAL(13, vec.front());
+}
+DECLARE_UNITTEST(TestUniqueCountDispatchImplicit);
+
+
 template<typename T>
 struct is_equal_div_10_unique
 {
@@ -167,6 +211,39 @@ struct TestUnique
 VariableUnitTest<TestUnique, IntegralTypes> TestUniqueInstance;
 
 
+void TestUniqueLarge(void)
+{
+    // sorted 64-bit ids, large enough for the parallel backends to split
+    // into many tiles, with runs of several lengths crossing their boundaries
+    const size_t n = (1 << 18) + 17;
+
+    size_t run_lengths[] = {1, 3, 1000, n / 3, n};
+
+    for(int r = 0; r < 5; ++r)
+    {
+        thrust::host_vector<unsigned long long> h_data(n);
+
+        for(size_t i = 0; i < n; ++i)
+        {
+            h_data[i] = 1000 * (i / run_lengths[r]);
+        }
+
+        thrust::device_vector<unsigned long long> d_data = h_data;
+
+        thrust::host_vector<unsigned long long>::iterator   h_new_last = thrust::unique(h_data.begin(), h_data.end());
+        thrust::device_vector<unsigned long long>::iterator d_new_last = thrust::unique(d_data.begin(), d_data.end());
+
+        ASSERT_EQUAL((n + run_lengths[r] - 1) / run_lengths[r], size_t(d_new_last - d_data.begin()));
+
+        h_data.resize(h_new_last - h_data.begin());
+        d_data.resize(d_new_last - d_data.begin());
+
+        ASSERT_EQUAL(h_data, d_data);
+    }
+}
+DECLARE_UNITTEST(TestUniqueLarge);
+
+
 template<typename Vector>
 void TestUniqueCopySimple(void)
 {
@@ -209,6 +286,51 @@ void TestUniqueCopySimple(void)
 DECLARE_VECTOR_UNITTEST(TestUniqueCopySimple);
 
 
+template<typename Vector>
+void TestUniqueCountSimple(void)
+{
+    typedef typename Vector::value_type T;
+
+    Vector data(10);
+    data[0] = 11; 
+    data[1] = 11; 
+    data[2] = 12;
+    data[3] = 20; 
+    data[4] = 29; 
+    data[5] = 21; 
+    data[6] = 21; 
+    data[7] = 31; 
+    data[8] = 31; 
+    data[9] = 37; 
+
+    ASSERT_EQUAL(7, thrust::unique_count(data.begin(), data.end()));
+    ASSERT_EQUAL(3, thrust::unique_count(data.begin(), data.end(), is_equal_div_10_unique<T>()));
+    ASSERT_EQUAL(0, thrust::unique_count(data.begin(), data.begin()));
+
+    // the input is unchanged
+    ASSERT_EQUAL(data[1], 11);
+}
+DECLARE_VECTOR_UNITTEST(TestUniqueCountSimple);
+
+
+template<typename T>
+struct TestUniqueCount
+{
+    void operator()(const size_t n)
+    {
+        thrust::host_vector<T>   h_data = unittest::random_integers<bool>(n);
+        thrust::device_vector<T> d_data = h_data;
+
+        size_t h_count = thrust::unique_count(h_data.begin(), h_data.end());
+        size_t d_count = thrust::unique_count(d_data.begin(), d_data.end());
+
+        ASSERT_EQUAL(h_count, d_count);
+        ASSERT_EQUAL(size_t(thrust::unique(h_data.begin(), h_data.end()) - h_data.begin()), h_count);
+    }
+};
+VariableUnitTest<TestUniqueCount, IntegralTypes> TestUniqueCountInstance;
+
+
 template<typename T>
 struct TestUniqueCopy
 {
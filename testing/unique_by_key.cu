@@ -293,6 +293,52 @@ struct TestUniqueByKey
 VariableUnitTest<TestUniqueByKey, IntegralTypes> TestUniqueByKeyInstance;
 
 
+void TestUniqueByKeyLarge(void)
+{
+    // large enough for the parallel backends to split into many tiles
+    const int n = (1 << 18) + 17;
+
+    int run_lengths[] = {1, 7, 5000, n};
+
+    for(int r = 0; r < 4; ++r)
+    {
+        thrust::host_vector<int> h_keys(n), h_values(n);
+
+        for(int i = 0; i < n; ++i)
+        {
+            h_keys[i]   = i / run_lengths[r];
+            h_values[i] = i;
+        }
+
+        thrust::device_vector<int> d_keys = h_keys;
+        thrust::device_vector<int> d_values = h_values;
+
+        typedef thrust::device_vector<int>::iterator Iterator;
+
+        thrust::pair<Iterator,Iterator> new_last = thrust::unique_by_key(d_keys.begin(), d_keys.end(), d_values.begin());
+
+        const int m = (n + run_lengths[r] - 1) / run_lengths[r];
+
+        ASSERT_EQUAL(m, new_last.first  - d_keys.begin());
+        ASSERT_EQUAL(m, new_last.second - d_values.begin());
+
+        thrust::host_vector<int> h_result_keys(d_keys.begin(), d_keys.begin() + m);
+        thrust::host_vector<int> h_result_values(d_values.begin(), d_values.begin() + m);
+
+        bool correct = true;
+
+        for(int i = 0; i < m; ++i)
+        {
+            // each key keeps the value of its first occurrence
+            correct = correct && h_result_keys[i] == i && h_result_values[i] == i * run_lengths[r];
+        }
+
+        ASSERT_EQUAL(true, correct);
+    }
+}
+DECLARE_UNITTEST(TestUniqueByKeyLarge);
+
+
 template<typename K>
 struct TestUniqueCopyByKey
 {
@@ -604,6 +604,57 @@ void TestVectorResizing(void)
 DECLARE_VECTOR_UNITTEST(TestVectorResizing);
 
 
+template <class Vector>
+void TestVectorNoInit(void)
+{
+    Vector v(3, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 3);
+
+    v[0] = 0; v[1] = 1; v[2] = 2;
+
+    // grow within and beyond the capacity
+    v.reserve(4);
+    v.resize(4, thrust::no_init);
+    v.resize(10, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 10);
+
+    ASSERT_EQUAL(v[0], 0);
+    ASSERT_EQUAL(v[1], 1);
+    ASSERT_EQUAL(v[2], 2);
+
+    v.resize(2, thrust::no_init);
+
+    ASSERT_EQUAL(v.size(), 2);
+    ASSERT_EQUAL(v[0], 0);
+    ASSERT_EQUAL(v[1], 1);
+}
+DECLARE_VECTOR_UNITTEST(TestVectorNoInit);
+
+
+struct nontrivially_constructible
+{
+    int x;
+
+    __host__ __device__
+    nontrivially_constructible() : x(13) {}
+};
+
+void TestVectorNoInitNontrivialType(void)
+{
+    // elements which need their constructor are constructed regardless
+    thrust::host_vector<nontrivially_constructible> v(3, thrust::no_init);
+
+    ASSERT_EQUAL(v[2].x, 13);
+
+    v.resize(10, thrust::no_init);
+
+    ASSERT_EQUAL(v[9].x, 13);
+}
+DECLARE_UNITTEST(TestVectorNoInitNontrivialType);
+
+
 
 template <class Vector>
 void TestVectorReserving(void)
@@ -0,0 +1,61 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/aligned_allocator.h>
+#include <thrust/system/detail/internal/aligned_allocation.h>
+#include <thrust/system/detail/bad_alloc.h>
+#include <thrust/detail/raw_pointer_cast.h>
+
+namespace thrust
+{
+namespace detail
+{
+
+
+template<typename T, typename System, typename Pointer, std::size_t Alignment>
+  typename aligned_allocator<T,System,Pointer,Alignment>::pointer
+    aligned_allocator<T,System,Pointer,Alignment>
+      ::allocate(typename aligned_allocator<T,System,Pointer,Alignment>::size_type cnt)
+{
+  if(cnt > this->max_size())
+  {
+    throw thrust::system::detail::bad_alloc("aligned_allocator::allocate: request is too large");
+  } // end if
+
+  void *result = thrust::system::detail::internal::allocate_aligned(cnt * sizeof(T), Alignment);
+
+  if(result == 0 && cnt > 0)
+  {
+    throw thrust::system::detail::bad_alloc("aligned_allocator::allocate: allocation failed");
+  } // end if
+
+  return pointer(static_cast<T*>(result));
+} // end aligned_allocator::allocate()
+
+
+template<typename T, typename System, typename Pointer, std::size_t Alignment>
+  void aligned_allocator<T,System,Pointer,Alignment>
+    ::deallocate(typename aligned_allocator<T,System,Pointer,Alignment>::pointer p, typename aligned_allocator<T,System,Pointer,Alignment>::size_type)
+{
+  thrust::system::detail::internal::deallocate_aligned(thrust::raw_pointer_cast(p));
+} // end aligned_allocator::deallocate()
+
+
+} // end detail
+} // end thrust
+
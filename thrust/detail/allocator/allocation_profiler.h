@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file allocation_profiler.h
+ *  \brief An allocator of temporary storage which records the allocations
+ *         made through it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/caching_allocator.h>
+#include <cstddef>
+#include <vector>
+
+namespace thrust
+{
+namespace detail
+{
+
+
+/*! \p allocation_profile reports the temporary allocations recorded by an
+ *  \p allocation_profiler.
+ */
+struct allocation_profile
+{
+  /*! The number of allocations.
+   */
+  std::size_t num_allocations;
+
+  /*! The total number of bytes requested by all allocations.
+   */
+  std::size_t bytes_allocated;
+
+  /*! The largest number of bytes allocated and not yet deallocated at once.
+   */
+  std::size_t peak_bytes;
+
+  /*! The number of bytes currently allocated. Once an algorithm returns,
+   *  this is zero.
+   */
+  std::size_t bytes_in_use;
+
+  /*! The size in bytes of each allocation, in the order they were made.
+   */
+  std::vector<std::size_t> allocation_sizes;
+};
+
+
+/*! \p allocation_profiler provides temporary storage from \p malloc and
+ *  records the number and size of the allocations made through it, and the
+ *  peak number of bytes allocated at once.
+ *
+ *  Passed to a host system's execution policy, e.g.
+ *  <tt>thrust::omp::par(profiler)</tt>, it observes every temporary buffer an
+ *  algorithm invocation allocates. Call \p reset between invocations to profile
+ *  each one separately. All member functions may be called concurrently.
+ */
+class allocation_profiler
+{
+  public:
+    typedef char value_type;
+
+    /*! This constructor creates an \p allocation_profiler with an empty profile.
+     */
+    inline allocation_profiler();
+
+    /*! Returns a block of at least \p num_bytes bytes and records its size.
+     *  \throw std::bad_alloc if the block cannot be obtained.
+     */
+    inline char *allocate(std::ptrdiff_t num_bytes);
+
+    /*! Frees a block obtained from \p allocate.
+     *  The size of the block is recorded with it, so \p n is ignored.
+     */
+    inline void deallocate(char *ptr, std::size_t n = 0);
+
+    /*! Returns a snapshot of the allocations recorded since construction or
+     *  the last call to \p reset.
+     */
+    inline allocation_profile profile();
+
+    /*! Clears the recorded allocations. Blocks still in use remain counted in
+     *  \p bytes_in_use.
+     */
+    inline void reset();
+
+  private:
+    std::size_t m_num_allocations;
+    std::size_t m_bytes_allocated;
+    std::size_t m_peak_bytes;
+    std::size_t m_bytes_in_use;
+    std::vector<std::size_t> m_allocation_sizes;
+    caching_allocator_detail::mutex m_mutex;
+
+    // not copyable
+    allocation_profiler(const allocation_profiler &);
+    allocation_profiler &operator=(const allocation_profiler &);
+};
+
+
+} // end detail
+} // end thrust
+
+#include <thrust/detail/allocator/allocation_profiler.inl>
+
@@ -0,0 +1,128 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/allocation_profiler.h>
+#include <cstdlib>
+#include <new>
+
+namespace thrust
+{
+namespace detail
+{
+namespace allocation_profiler_detail
+{
+
+
+// each block is preceded by a header recording its size
+// the header is as large as the strictest fundamental alignment
+// so that the block which follows it keeps malloc's alignment
+union header
+{
+  std::size_t size;
+  long double ld;
+  void *ptr;
+  long long ll;
+};
+
+
+} // end allocation_profiler_detail
+
+
+allocation_profiler::allocation_profiler()
+  : m_num_allocations(0),
+    m_bytes_allocated(0),
+    m_peak_bytes(0),
+    m_bytes_in_use(0),
+    m_allocation_sizes()
+{}
+
+
+char *allocation_profiler::allocate(std::ptrdiff_t num_bytes)
+{
+  namespace ns = allocation_profiler_detail;
+
+  const std::size_t size = static_cast<std::size_t>(num_bytes);
+
+  ns::header *block = static_cast<ns::header*>(std::malloc(sizeof(ns::header) + size));
+
+  if(block == 0) throw std::bad_alloc();
+
+  block->size = size;
+
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  ++m_num_allocations;
+  m_bytes_allocated += size;
+  m_bytes_in_use    += size;
+  m_allocation_sizes.push_back(size);
+
+  if(m_bytes_in_use > m_peak_bytes) m_peak_bytes = m_bytes_in_use;
+
+  return reinterpret_cast<char*>(block + 1);
+}
+
+
+void allocation_profiler::deallocate(char *ptr, std::size_t)
+{
+  namespace ns = allocation_profiler_detail;
+
+  if(ptr == 0) return;
+
+  ns::header *block = reinterpret_cast<ns::header*>(ptr) - 1;
+
+  {
+    caching_allocator_detail::lock_guard guard(m_mutex);
+
+    m_bytes_in_use -= block->size;
+  }
+
+  std::free(block);
+}
+
+
+allocation_profile allocation_profiler::profile()
+{
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  allocation_profile result;
+  result.num_allocations  = m_num_allocations;
+  result.bytes_allocated  = m_bytes_allocated;
+  result.peak_bytes       = m_peak_bytes;
+  result.bytes_in_use     = m_bytes_in_use;
+  result.allocation_sizes = m_allocation_sizes;
+
+  return result;
+}
+
+
+void allocation_profiler::reset()
+{
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  m_num_allocations = 0;
+  m_bytes_allocated = 0;
+  m_peak_bytes      = m_bytes_in_use;
+  m_allocation_sizes.clear();
+}
+
+
+} // end detail
+} // end thrust
+
@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file arena.h
+ *  \brief A monotonic allocator which carves the temporary storage of a
+ *         sequence of algorithms from a single block of host memory.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/caching_allocator.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace detail
+{
+
+
+/*! \p arena_statistics reports the activity of an \p arena.
+ */
+struct arena_statistics
+{
+  /*! The number of bytes of the arena's block which are not yet available
+   *  for reuse, including per-allocation overhead.
+   */
+  std::size_t bytes_in_use;
+
+  /*! The largest value of \p bytes_in_use since the arena was created.
+   *  An arena of at least this capacity satisfies the same sequence of
+   *  requests without overflowing.
+   */
+  std::size_t high_water_mark;
+
+  /*! The number of allocations which did not fit in the arena's block and
+   *  were obtained from \p malloc instead.
+   */
+  std::size_t overflows;
+};
+
+
+/*! \p arena reserves one block of host memory when it is created and hands
+ *  out pieces of it by advancing an offset. The storage of a deallocated
+ *  piece is reclaimed at once if it was the most recent allocation, and
+ *  otherwise once every piece has been deallocated. The block itself is
+ *  freed when the \p arena is destroyed.
+ *
+ *  Used as the temporary storage of the host systems' execution policies,
+ *  e.g. <tt>thrust::omp::par(a)</tt>, an \p arena lets a pipeline of algorithms
+ *  run without calling \p malloc. A request which does not fit is served by
+ *  \p malloc and counted in \p arena_statistics::overflows rather than failing.
+ *  All member functions may be called concurrently.
+ */
+class arena
+{
+  public:
+    typedef char value_type;
+
+    /*! This constructor reserves the arena's block.
+     *  \param capacity The size of the block in bytes.
+     *  \throw std::bad_alloc if the block cannot be obtained.
+     */
+    inline explicit arena(std::size_t capacity);
+
+    /*! The destructor frees the arena's block. Pieces still in use become invalid.
+     */
+    inline ~arena();
+
+    /*! Returns a piece of at least \p num_bytes bytes aligned to 64 bytes.
+     *  \throw std::bad_alloc if the piece does not fit and \p malloc fails.
+     */
+    inline char *allocate(std::ptrdiff_t num_bytes);
+
+    /*! Returns a piece obtained from \p allocate to the arena.
+     *  The extent of the piece is recorded with it, so \p n is ignored.
+     */
+    inline void deallocate(char *ptr, std::size_t n = 0);
+
+    /*! Reclaims the whole block. Every piece must have been deallocated.
+     */
+    inline void release();
+
+    /*! Returns the size of the arena's block in bytes.
+     */
+    inline std::size_t capacity() const;
+
+    /*! Returns a snapshot of this arena's statistics.
+     */
+    inline arena_statistics statistics();
+
+  private:
+    char *m_begin;
+    std::size_t m_capacity;
+    std::size_t m_top;
+    std::size_t m_num_live;
+    std::size_t m_high_water_mark;
+    std::size_t m_overflows;
+    caching_allocator_detail::mutex m_mutex;
+
+    // not copyable
+    arena(const arena &);
+    arena &operator=(const arena &);
+};
+
+
+} // end detail
+} // end thrust
+
+#include <thrust/detail/allocator/arena.inl>
+
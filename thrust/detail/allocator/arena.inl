@@ -0,0 +1,168 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/arena.h>
+#include <thrust/system/detail/internal/aligned_allocation.h>
+#include <cstdlib>
+#include <new>
+
+namespace thrust
+{
+namespace detail
+{
+namespace arena_detail
+{
+
+
+// each piece is preceded by a header recording the extent of the arena it
+// occupies; pieces begin on cache line boundaries
+const std::size_t alignment = 64;
+
+
+struct header
+{
+  std::size_t begin;
+  std::size_t end;
+};
+
+
+inline std::size_t round_up(std::size_t x)
+{
+  return (x + alignment - 1) / alignment * alignment;
+}
+
+
+} // end arena_detail
+
+
+arena::arena(std::size_t capacity)
+  : m_begin(0),
+    m_capacity(arena_detail::round_up(capacity)),
+    m_top(0),
+    m_num_live(0),
+    m_high_water_mark(0),
+    m_overflows(0)
+{
+  if(m_capacity > 0)
+  {
+    m_begin = static_cast<char*>(thrust::system::detail::internal::allocate_aligned(m_capacity, arena_detail::alignment));
+
+    if(m_begin == 0) throw std::bad_alloc();
+  }
+}
+
+
+arena::~arena()
+{
+  thrust::system::detail::internal::deallocate_aligned(m_begin);
+}
+
+
+char *arena::allocate(std::ptrdiff_t num_bytes)
+{
+  namespace ns = arena_detail;
+
+  {
+    caching_allocator_detail::lock_guard guard(m_mutex);
+
+    const std::size_t begin = m_top;
+    const std::size_t end   = begin + ns::alignment + ns::round_up(static_cast<std::size_t>(num_bytes));
+
+    if(end <= m_capacity)
+    {
+      ns::header *h = reinterpret_cast<ns::header*>(m_begin + begin);
+      h->begin = begin;
+      h->end   = end;
+
+      m_top = end;
+      ++m_num_live;
+
+      if(m_top > m_high_water_mark) m_high_water_mark = m_top;
+
+      return m_begin + begin + ns::alignment;
+    }
+
+    ++m_overflows;
+  }
+
+  void *result = thrust::system::detail::internal::allocate_aligned(static_cast<std::size_t>(num_bytes), ns::alignment);
+
+  if(result == 0) throw std::bad_alloc();
+
+  return static_cast<char*>(result);
+}
+
+
+void arena::deallocate(char *ptr, std::size_t)
+{
+  namespace ns = arena_detail;
+
+  if(ptr == 0) return;
+
+  // pieces outside the block overflowed to malloc
+  if(ptr < m_begin || ptr >= m_begin + m_capacity)
+  {
+    thrust::system::detail::internal::deallocate_aligned(ptr);
+    return;
+  }
+
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  const ns::header *h = reinterpret_cast<const ns::header*>(ptr - ns::alignment);
+
+  // the most recent piece is reclaimed immediately
+  if(h->end == m_top) m_top = h->begin;
+
+  // the others are reclaimed when the arena empties
+  if(--m_num_live == 0) m_top = 0;
+}
+
+
+void arena::release()
+{
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  m_top      = 0;
+  m_num_live = 0;
+}
+
+
+std::size_t arena::capacity() const
+{
+  return m_capacity;
+}
+
+
+arena_statistics arena::statistics()
+{
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  arena_statistics result;
+  result.bytes_in_use    = m_top;
+  result.high_water_mark = m_high_water_mark;
+  result.overflows       = m_overflows;
+
+  return result;
+}
+
+
+} // end detail
+} // end thrust
+
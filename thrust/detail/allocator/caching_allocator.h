@@ -0,0 +1,207 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file caching_allocator.h
+ *  \brief A thread-safe allocator which caches host memory blocks for reuse
+ *         as temporary storage.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef>
+#include <vector>
+
+// MSVC reports __cplusplus as 199711L unless /Zc:__cplusplus is given, but has
+// provided std::mutex since Visual Studio 2012
+#if __cplusplus >= 201103L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#define THRUST_CACHING_ALLOCATOR_HAS_STD_MUTEX 1
+#else
+#define THRUST_CACHING_ALLOCATOR_HAS_STD_MUTEX 0
+#endif
+
+#if THRUST_CACHING_ALLOCATOR_HAS_STD_MUTEX
+#include <mutex>
+#elif defined(_WIN32)
+// keep windows.h from defining min and max macros, which would break
+// thrust::min, thrust::max and user code
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#    define THRUST_CACHING_ALLOCATOR_UNDEF_NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#    define THRUST_CACHING_ALLOCATOR_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  ifdef THRUST_CACHING_ALLOCATOR_UNDEF_NOMINMAX
+#    undef NOMINMAX
+#    undef THRUST_CACHING_ALLOCATOR_UNDEF_NOMINMAX
+#  endif
+#  ifdef THRUST_CACHING_ALLOCATOR_UNDEF_WIN32_LEAN_AND_MEAN
+#    undef WIN32_LEAN_AND_MEAN
+#    undef THRUST_CACHING_ALLOCATOR_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#else
+#include <pthread.h>
+#endif
+
+namespace thrust
+{
+namespace detail
+{
+namespace caching_allocator_detail
+{
+
+
+class mutex
+{
+  public:
+    inline mutex();
+
+    inline ~mutex();
+
+    inline void lock();
+
+    inline void unlock();
+
+  private:
+#if THRUST_CACHING_ALLOCATOR_HAS_STD_MUTEX
+    std::mutex m_impl;
+#elif defined(_WIN32)
+    CRITICAL_SECTION m_impl;
+#else
+    pthread_mutex_t m_impl;
+#endif
+
+    // not copyable
+    mutex(const mutex &);
+    mutex &operator=(const mutex &);
+};
+
+
+class lock_guard
+{
+  public:
+    explicit lock_guard(mutex &m) : m_mutex(m) { m_mutex.lock(); }
+
+    ~lock_guard() { m_mutex.unlock(); }
+
+  private:
+    mutex &m_mutex;
+
+    // not copyable
+    lock_guard(const lock_guard &);
+    lock_guard &operator=(const lock_guard &);
+};
+
+
+} // end caching_allocator_detail
+
+
+/*! \p caching_allocator_statistics reports the activity of a \p caching_allocator.
+ */
+struct caching_allocator_statistics
+{
+  /*! The number of allocations satisfied by a cached block.
+   */
+  std::size_t hits;
+
+  /*! The number of allocations which had to request memory from the system.
+   */
+  std::size_t misses;
+
+  /*! The number of bytes held in the cache, available for reuse.
+   */
+  std::size_t bytes_retained;
+
+  /*! The largest number of bytes held from the system at once, whether in
+   *  use or in the cache.
+   */
+  std::size_t high_water_mark;
+};
+
+
+/*! \p caching_allocator hands out blocks of host memory and, rather than
+ *  returning them to the system when they are deallocated, keeps them in bins
+ *  of similar size for later requests. Sizes are rounded up to one of four
+ *  classes per power of two, so a block is at most 25% larger than requested.
+ *
+ *  The cache holds at most \p max_bytes_retained bytes; a block deallocated
+ *  while the cache is full is freed immediately. All member functions may be
+ *  called concurrently.
+ *
+ *  \p caching_allocator is intended as temporary storage for the host
+ *  systems' execution policies, e.g. <tt>thrust::omp::par(alloc)</tt>. It must
+ *  outlive any algorithm invocation that uses it.
+ */
+class caching_allocator
+{
+  public:
+    typedef char value_type;
+
+    /*! This constructor creates an empty \p caching_allocator.
+     *  \param max_bytes_retained The capacity of the cache.
+     */
+    inline explicit caching_allocator(std::size_t max_bytes_retained = 1u << 30);
+
+    /*! The destructor frees all cached blocks. Blocks still in use are not freed.
+     */
+    inline ~caching_allocator();
+
+    /*! Returns a block of at least \p num_bytes bytes.
+     *  \throw std::bad_alloc if the system cannot provide the block.
+     */
+    inline char *allocate(std::ptrdiff_t num_bytes);
+
+    /*! Returns a block obtained from \p allocate to the cache.
+     *  The size of the block is recorded with it, so \p n is ignored.
+     */
+    inline void deallocate(char *ptr, std::size_t n = 0);
+
+    /*! Frees all cached blocks.
+     */
+    inline void free_all();
+
+    /*! Returns a snapshot of this allocator's statistics.
+     */
+    inline caching_allocator_statistics statistics();
+
+  private:
+    // one bin per size class
+    std::vector<std::vector<void*> > m_bins;
+    std::size_t m_max_bytes_retained;
+    std::size_t m_bytes_retained;
+    std::size_t m_bytes_held;
+    std::size_t m_high_water_mark;
+    std::size_t m_hits;
+    std::size_t m_misses;
+    caching_allocator_detail::mutex m_mutex;
+
+    inline void free_all_unlocked();
+
+    // not copyable
+    caching_allocator(const caching_allocator &);
+    caching_allocator &operator=(const caching_allocator &);
+};
+
+
+} // end detail
+} // end thrust
+
+#include <thrust/detail/allocator/caching_allocator.inl>
+
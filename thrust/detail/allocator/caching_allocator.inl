@@ -0,0 +1,236 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/caching_allocator.h>
+#include <cstdlib>
+#include <new>
+
+namespace thrust
+{
+namespace detail
+{
+namespace caching_allocator_detail
+{
+
+
+#if THRUST_CACHING_ALLOCATOR_HAS_STD_MUTEX
+mutex::mutex() {}
+mutex::~mutex() {}
+void mutex::lock()   { m_impl.lock(); }
+void mutex::unlock() { m_impl.unlock(); }
+#elif defined(_WIN32)
+mutex::mutex()  { InitializeCriticalSection(&m_impl); }
+mutex::~mutex() { DeleteCriticalSection(&m_impl); }
+void mutex::lock()   { EnterCriticalSection(&m_impl); }
+void mutex::unlock() { LeaveCriticalSection(&m_impl); }
+#else
+mutex::mutex()  { pthread_mutex_init(&m_impl, 0); }
+mutex::~mutex() { pthread_mutex_destroy(&m_impl); }
+void mutex::lock()   { pthread_mutex_lock(&m_impl); }
+void mutex::unlock() { pthread_mutex_unlock(&m_impl); }
+#endif
+
+
+// each block is preceded by a header recording its size class
+// the header is as large as the strictest fundamental alignment
+// so that the block which follows it keeps malloc's alignment
+union header
+{
+  std::size_t size_class;
+  long double ld;
+  void *ptr;
+  long long ll;
+};
+
+
+// there are four size classes for each power of two; class c holds blocks of
+// (4 + c % 4) << (c / 4 - 2) bytes, the smallest of which is min_block_size
+const std::size_t min_block_size = 256;
+const std::size_t min_class      = 4 * 8;
+
+
+inline std::size_t size_class(std::size_t num_bytes)
+{
+  if(num_bytes <= min_block_size) return min_class;
+
+  // find k such that 2^k <= num_bytes - 1 < 2^(k+1)
+  std::size_t k = 0;
+  for(std::size_t x = (num_bytes - 1) >> 1; x != 0; x >>= 1) ++k;
+
+  // round up to a quarter of 2^k
+  std::size_t quarter = std::size_t(1) << (k - 2);
+  std::size_t quarters = (num_bytes + quarter - 1) / quarter;
+
+  // quarters is in [5, 8]; 8 quarters begins the next power of two
+  return quarters == 8 ? 4 * (k + 1) : 4 * k + (quarters - 4);
+}
+
+
+inline std::size_t class_size(std::size_t c)
+{
+  return (4 + c % 4) << (c / 4 - 2);
+}
+
+
+} // end caching_allocator_detail
+
+
+caching_allocator::caching_allocator(std::size_t max_bytes_retained)
+  : m_bins(),
+    m_max_bytes_retained(max_bytes_retained),
+    m_bytes_retained(0),
+    m_bytes_held(0),
+    m_high_water_mark(0),
+    m_hits(0),
+    m_misses(0)
+{}
+
+
+caching_allocator::~caching_allocator()
+{
+  free_all();
+}
+
+
+char *caching_allocator::allocate(std::ptrdiff_t num_bytes)
+{
+  namespace ns = caching_allocator_detail;
+
+  const std::size_t c    = ns::size_class(static_cast<std::size_t>(num_bytes) + sizeof(ns::header));
+  const std::size_t size = ns::class_size(c);
+
+  void *block = 0;
+
+  {
+    ns::lock_guard guard(m_mutex);
+
+    if(c < m_bins.size() && !m_bins[c].empty())
+    {
+      block = m_bins[c].back();
+      m_bins[c].pop_back();
+
+      m_bytes_retained -= size;
+      ++m_hits;
+    }
+    else
+    {
+      ++m_misses;
+    }
+  }
+
+  if(block == 0)
+  {
+    block = std::malloc(size);
+
+    if(block == 0)
+    {
+      // give the cache back to the system and try again
+      free_all();
+
+      block = std::malloc(size);
+
+      if(block == 0) throw std::bad_alloc();
+    }
+
+    static_cast<ns::header*>(block)->size_class = c;
+
+    ns::lock_guard guard(m_mutex);
+
+    m_bytes_held += size;
+
+    if(m_bytes_held > m_high_water_mark) m_high_water_mark = m_bytes_held;
+  }
+
+  return reinterpret_cast<char*>(static_cast<ns::header*>(block) + 1);
+}
+
+
+void caching_allocator::deallocate(char *ptr, std::size_t)
+{
+  namespace ns = caching_allocator_detail;
+
+  if(ptr == 0) return;
+
+  ns::header *block = reinterpret_cast<ns::header*>(ptr) - 1;
+
+  const std::size_t c    = block->size_class;
+  const std::size_t size = ns::class_size(c);
+
+  {
+    ns::lock_guard guard(m_mutex);
+
+    if(m_bytes_retained + size <= m_max_bytes_retained)
+    {
+      if(c >= m_bins.size()) m_bins.resize(c + 1);
+
+      m_bins[c].push_back(block);
+      m_bytes_retained += size;
+
+      return;
+    }
+
+    m_bytes_held -= size;
+  }
+
+  std::free(block);
+}
+
+
+void caching_allocator::free_all()
+{
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  free_all_unlocked();
+}
+
+
+void caching_allocator::free_all_unlocked()
+{
+  for(std::size_t c = 0; c < m_bins.size(); ++c)
+  {
+    for(std::size_t i = 0; i < m_bins[c].size(); ++i)
+    {
+      std::free(m_bins[c][i]);
+    }
+
+    m_bins[c].clear();
+  }
+
+  m_bytes_held    -= m_bytes_retained;
+  m_bytes_retained = 0;
+}
+
+
+caching_allocator_statistics caching_allocator::statistics()
+{
+  caching_allocator_detail::lock_guard guard(m_mutex);
+
+  caching_allocator_statistics result;
+  result.hits            = m_hits;
+  result.misses          = m_misses;
+  result.bytes_retained  = m_bytes_retained;
+  result.high_water_mark = m_high_water_mark;
+
+  return result;
+}
+
+
+} // end detail
+} // end thrust
+
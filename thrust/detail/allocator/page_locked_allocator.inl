@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/allocator/page_locked_allocator.h>
+#include <thrust/system/detail/internal/first_touch.h>
+#include <thrust/system/detail/internal/page_locking.h>
+#include <thrust/system/detail/bad_alloc.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/for_each.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace detail
+{
+namespace page_locked_allocator_detail
+{
+
+
+// writes the first byte of the i-th page of a block
+struct touch_page
+{
+  char *first;
+  std::size_t page;
+
+  touch_page(char *first, std::size_t page)
+    : first(first), page(page)
+  {}
+
+  inline void operator()(std::size_t i) const
+  {
+    first[i * page] = 0;
+  }
+};
+
+
+} // end page_locked_allocator_detail
+
+
+template<typename T, typename System, typename Pointer>
+  typename page_locked_allocator<T,System,Pointer>::pointer
+    page_locked_allocator<T,System,Pointer>
+      ::allocate(typename page_locked_allocator<T,System,Pointer>::size_type cnt)
+{
+  if(cnt > this->max_size())
+  {
+    throw thrust::system::detail::bad_alloc("page_locked_allocator::allocate: request is too large");
+  } // end if
+
+  const std::size_t num_bytes = cnt * sizeof(T);
+
+  char *result = static_cast<char*>(thrust::system::detail::internal::allocate_untouched(num_bytes));
+
+  if(result == 0 && cnt > 0)
+  {
+    throw thrust::system::detail::bad_alloc("page_locked_allocator::allocate: allocation failed");
+  } // end if
+
+  // fault in every page, in parallel where System allows
+  // consecutive writes are at most a page apart, so together with the
+  // last byte they reach every page the block overlaps
+  const std::size_t page = thrust::system::detail::internal::page_size();
+
+  const std::size_t num_pages = (num_bytes + page - 1) / page;
+
+  System system;
+  thrust::for_each(system,
+                   thrust::counting_iterator<std::size_t>(0),
+                   thrust::counting_iterator<std::size_t>(num_pages),
+                   page_locked_allocator_detail::touch_page(result, page));
+
+  if(num_bytes > 0)
+  {
+    result[num_bytes - 1] = 0;
+  } // end if
+
+  // then keep them resident where the locked memory limit allows
+  thrust::system::detail::internal::lock_pages(result, num_bytes);
+
+  return pointer(reinterpret_cast<T*>(result));
+} // end page_locked_allocator::allocate()
+
+
+template<typename T, typename System, typename Pointer>
+  void page_locked_allocator<T,System,Pointer>
+    ::deallocate(typename page_locked_allocator<T,System,Pointer>::pointer p, typename page_locked_allocator<T,System,Pointer>::size_type cnt)
+{
+  void *ptr = thrust::raw_pointer_cast(p);
+
+  thrust::system::detail::internal::unlock_pages(ptr, cnt * sizeof(T));
+  thrust::system::detail::internal::deallocate_untouched(ptr, cnt * sizeof(T));
+} // end page_locked_allocator::deallocate()
+
+
+} // end detail
+} // end thrust
+
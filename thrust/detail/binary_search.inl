@@ -233,6 +233,37 @@ OutputIterator binary_search(const thrust::detail::execution_policy_base<Derived
 }
 
 
+__thrust_exec_check_disable__ 
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename OutputIterator>
+__host__ __device__
+OutputIterator sorted_search(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             ForwardIterator first, 
+                             ForwardIterator last,
+                             InputIterator values_first, 
+                             InputIterator values_last,
+                             OutputIterator output)
+{
+    using thrust::system::detail::generic::sorted_search;
+    return sorted_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output);
+}
+
+
+__thrust_exec_check_disable__ 
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename OutputIterator, typename StrictWeakOrdering>
+__host__ __device__
+OutputIterator sorted_search(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             ForwardIterator first, 
+                             ForwardIterator last,
+                             InputIterator values_first, 
+                             InputIterator values_last,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+    using thrust::system::detail::generic::sorted_search;
+    return sorted_search(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, values_first, values_last, output, comp);
+}
+
+
 //////////////////////
 // Scalar Functions //
 //////////////////////
@@ -482,5 +513,46 @@ OutputIterator binary_search(ForwardIterator first,
     return thrust::binary_search(select_system(system1,system2,system3), first, last, values_first, values_last, output, comp);
 }
 
+template <typename ForwardIterator, typename InputIterator, typename OutputIterator>
+OutputIterator sorted_search(ForwardIterator first, 
+                             ForwardIterator last,
+                             InputIterator values_first, 
+                             InputIterator values_last,
+                             OutputIterator output)
+{
+    using thrust::system::detail::generic::select_system;
+
+    typedef typename thrust::iterator_system<ForwardIterator>::type System1;
+    typedef typename thrust::iterator_system<InputIterator>::type   System2;
+    typedef typename thrust::iterator_system<OutputIterator>::type  System3;
+
+    System1 system1;
+    System2 system2;
+    System3 system3;
+
+    return thrust::sorted_search(select_system(system1,system2,system3), first, last, values_first, values_last, output);
+}
+
+template <typename ForwardIterator, typename InputIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator sorted_search(ForwardIterator first, 
+                             ForwardIterator last,
+                             InputIterator values_first, 
+                             InputIterator values_last,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+    using thrust::system::detail::generic::select_system;
+
+    typedef typename thrust::iterator_system<ForwardIterator>::type System1;
+    typedef typename thrust::iterator_system<InputIterator>::type   System2;
+    typedef typename thrust::iterator_system<OutputIterator>::type  System3;
+
+    System1 system1;
+    System2 system2;
+    System3 system3;
+
+    return thrust::sorted_search(select_system(system1,system2,system3), first, last, values_first, values_last, output, comp);
+}
+
 } // end namespace thrust
 
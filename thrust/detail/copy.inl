@@ -17,6 +17,8 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/copy.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/detail/any_system_tag.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/adl/copy.h>
@@ -55,6 +57,134 @@ namespace detail
 {
 
 
+namespace copy_detail
+{
+
+
+// true when System1 is derived from System2 but not the other way around
+// any_system_tag converts to every system but cannot execute anything itself
+template<typename System1, typename System2>
+  struct is_more_derived_system
+    : integral_constant<
+        bool,
+        is_convertible<System1,System2>::value && !is_convertible<System2,System1>::value
+          && !is_same<System1,thrust::any_system_tag>::value
+      >
+{};
+
+
+template<typename System1, typename System2>
+  struct has_more_derived_system
+    : integral_constant<
+        bool,
+        is_more_derived_system<System1,System2>::value || is_more_derived_system<System2,System1>::value
+      >
+{};
+
+
+template<typename System1, typename System2>
+__host__ __device__
+  typename enable_if<
+    is_more_derived_system<System1,System2>::value,
+    System1 &
+  >::type
+    select_more_derived_system(System1 &system1, System2 &)
+{
+  return system1;
+} // end select_more_derived_system()
+
+
+template<typename System1, typename System2>
+__host__ __device__
+  typename enable_if<
+    is_more_derived_system<System2,System1>::value,
+    System2 &
+  >::type
+    select_more_derived_system(System1 &, System2 &system2)
+{
+  return system2;
+} // end select_more_derived_system()
+
+
+// a copy between a system and a system derived from it, such as cpp and omp,
+// runs in the derived system, which may copy in parallel
+__thrust_exec_check_disable__
+template<typename System1,
+         typename System2,
+         typename InputIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator two_system_copy(System1 &system1,
+                                 System2 &system2,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator result,
+                                 thrust::detail::true_type) // has_more_derived_system
+{
+  return thrust::copy(select_more_derived_system(system1, system2), first, last, result);
+} // end two_system_copy()
+
+
+__thrust_exec_check_disable__
+template<typename System1,
+         typename System2,
+         typename InputIterator,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator two_system_copy(System1 &system1,
+                                 System2 &system2,
+                                 InputIterator first,
+                                 InputIterator last,
+                                 OutputIterator result,
+                                 thrust::detail::false_type) // has_more_derived_system
+{
+  using thrust::system::detail::generic::select_system;
+
+  return thrust::copy(select_system(system1, system2), first, last, result);
+} // end two_system_copy()
+
+
+__thrust_exec_check_disable__
+template<typename System1,
+         typename System2,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator two_system_copy_n(System1 &system1,
+                                   System2 &system2,
+                                   InputIterator first,
+                                   Size n,
+                                   OutputIterator result,
+                                   thrust::detail::true_type) // has_more_derived_system
+{
+  return thrust::copy_n(select_more_derived_system(system1, system2), first, n, result);
+} // end two_system_copy_n()
+
+
+__thrust_exec_check_disable__
+template<typename System1,
+         typename System2,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+__host__ __device__
+  OutputIterator two_system_copy_n(System1 &system1,
+                                   System2 &system2,
+                                   InputIterator first,
+                                   Size n,
+                                   OutputIterator result,
+                                   thrust::detail::false_type) // has_more_derived_system
+{
+  using thrust::system::detail::generic::select_system;
+
+  return thrust::copy_n(select_system(system1, system2), first, n, result);
+} // end two_system_copy_n()
+
+
+} // end copy_detail
+
+
 __thrust_exec_check_disable__ // because we might call e.g. std::ostream_iterator's constructor
 template<typename System1,
          typename System2,
@@ -67,9 +197,10 @@ __host__ __device__
                                  InputIterator last,
                                  OutputIterator result)
 {
-  using thrust::system::detail::generic::select_system;
-
-  return thrust::copy(select_system(thrust::detail::derived_cast(thrust::detail::strip_const(system1)), thrust::detail::derived_cast(thrust::detail::strip_const(system2))), first, last, result);
+  return copy_detail::two_system_copy(thrust::detail::derived_cast(thrust::detail::strip_const(system1)),
+                                      thrust::detail::derived_cast(thrust::detail::strip_const(system2)),
+                                      first, last, result,
+                                      typename copy_detail::has_more_derived_system<System1,System2>::type());
 } // end two_system_copy()
 
 
@@ -86,9 +217,10 @@ __host__ __device__
                                    Size n,
                                    OutputIterator result)
 {
-  using thrust::system::detail::generic::select_system;
-
-  return thrust::copy_n(select_system(thrust::detail::derived_cast(thrust::detail::strip_const(system1)), thrust::detail::derived_cast(thrust::detail::strip_const(system2))), first, n, result);
+  return copy_detail::two_system_copy_n(thrust::detail::derived_cast(thrust::detail::strip_const(system1)),
+                                        thrust::detail::derived_cast(thrust::detail::strip_const(system2)),
+                                        first, n, result,
+                                        typename copy_detail::has_more_derived_system<System1,System2>::type());
 } // end two_system_copy_n()
 
 
@@ -0,0 +1,64 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file no_init.h
+ *  \brief Defines the tag which requests uninitialized vector elements.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+namespace thrust
+{
+
+
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! \p no_init_t is the type of \p thrust::no_init.
+ */
+struct no_init_t {};
+
+
+/*! \p thrust::no_init requests that a vector's constructor or \p resize leave
+ *  new elements uninitialized rather than value-initializing them. Elements
+ *  of types with a trivial default constructor are left indeterminate, which
+ *  saves a full pass over memory when they are about to be overwritten.
+ *  Elements of other types are default-constructed as usual.
+ *
+ *  \code
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/sequence.h>
+ *  ...
+ *  // allocate 1M floats without writing them
+ *  thrust::device_vector<float> vec(1 << 20, thrust::no_init);
+ *
+ *  thrust::sequence(vec.begin(), vec.end());
+ *
+ *  // append 1M more, also uninitialized
+ *  vec.resize(2 << 20, thrust::no_init);
+ *  \endcode
+ */
+static const no_init_t no_init = no_init_t();
+
+/*! \}
+ */
+
+
+} // end thrust
+
@@ -0,0 +1,414 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file partial_sort.inl
+ *  \brief Inline file for partial_sort.h.
+ */
+
+#include <thrust/detail/config.h>
+#include <thrust/partial_sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/generic/partial_sort.h>
+#include <thrust/system/detail/adl/partial_sort.h>
+
+namespace thrust
+{
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last);
+} // end nth_element()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::nth_element;
+  return nth_element(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, nth, last, comp);
+} // end nth_element()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last);
+} // end partial_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::partial_sort;
+  return partial_sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, middle, last, comp);
+} // end partial_sort()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator>
+__host__ __device__
+  RandomAccessIterator partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last)
+{
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::partial_sort_copy;
+  return partial_sort_copy(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+__host__ __device__
+  RandomAccessIterator top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result)
+{
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result);
+} // end top_k()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::top_k;
+  return top_k(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, k, result, comp);
+} // end top_k()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result)
+{
+  using thrust::system::detail::generic::top_k_by_key;
+  return top_k_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, k, keys_result, values_result);
+} // end top_k_by_key()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::top_k_by_key;
+  return top_k_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, k, keys_result, values_result, comp);
+} // end top_k_by_key()
+
+
+template<typename RandomAccessIterator>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last);
+} // end nth_element()
+
+
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::nth_element(select_system(system), first, nth, last, comp);
+} // end nth_element()
+
+
+template<typename RandomAccessIterator>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last);
+} // end partial_sort()
+
+
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::partial_sort(select_system(system), first, middle, last, comp);
+} // end partial_sort()
+
+
+template<typename InputIterator,
+         typename RandomAccessIterator>
+  RandomAccessIterator partial_sort_copy(InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type        System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1,system2), first, last, result_first, result_last);
+} // end partial_sort_copy()
+
+
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  RandomAccessIterator partial_sort_copy(InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type        System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::partial_sort_copy(select_system(system1,system2), first, last, result_first, result_last, comp);
+} // end partial_sort_copy()
+
+
+template<typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+  RandomAccessIterator top_k(InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type        System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1,system2), first, last, k, result);
+} // end top_k()
+
+
+template<typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  RandomAccessIterator top_k(InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator>::type        System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::top_k(select_system(system1,system2), first, last, k, result, comp);
+} // end top_k()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator1>::type        System1;
+  typedef typename thrust::iterator_system<InputIterator2>::type        System2;
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System3;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::top_k_by_key(select_system(system1,system2,system3,system4), keys_first, keys_last, values_first, k, keys_result, values_result);
+} // end top_k_by_key()
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<InputIterator1>::type        System1;
+  typedef typename thrust::iterator_system<InputIterator2>::type        System2;
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System3;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System4;
+
+  System1 system1;
+  System2 system2;
+  System3 system3;
+  System4 system4;
+
+  return thrust::top_k_by_key(select_system(system1,system2,system3,system4), keys_first, keys_last, values_first, k, keys_result, values_result, comp);
+} // end top_k_by_key()
+
+
+} // end thrust
+
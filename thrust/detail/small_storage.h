@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file small_storage.h
+ *  \brief Storage for vector_base with room for a few elements inside the
+ *         object itself.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/vector_base.h>
+#include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits.h>
+#include <cstddef>
+
+namespace thrust
+{
+
+namespace detail
+{
+
+// a vector_base whose allocator is a small_buffer_allocator keeps up to N
+// elements inside the vector itself and allocates from Alloc beyond that
+template<typename T, std::size_t N, typename Alloc>
+  struct small_buffer_allocator
+    : Alloc
+{
+  inline small_buffer_allocator() {}
+
+  inline small_buffer_allocator(const Alloc &alloc)
+    : Alloc(alloc)
+  {}
+};
+
+
+// the in-object buffer is copied bytewise when storages are swapped,
+// so T must be trivially copyable
+template<typename T, std::size_t N, typename Alloc>
+  class small_storage
+{
+  private:
+    typedef thrust::detail::contiguous_storage<T,Alloc> heap_storage;
+
+    THRUST_STATIC_ASSERT(N > 0);
+    THRUST_STATIC_ASSERT(has_trivial_copy_constructor<T>::value);
+
+  public:
+    typedef small_buffer_allocator<T,N,Alloc>          allocator_type;
+    typedef typename heap_storage::value_type          value_type;
+    typedef typename heap_storage::pointer             pointer;
+    typedef typename heap_storage::const_pointer       const_pointer;
+    typedef typename heap_storage::size_type           size_type;
+    typedef typename heap_storage::difference_type     difference_type;
+    typedef typename heap_storage::reference           reference;
+    typedef typename heap_storage::const_reference     const_reference;
+    typedef typename heap_storage::iterator            iterator;
+    typedef typename heap_storage::const_iterator      const_iterator;
+
+    // the storage begins with room for N elements in the buffer
+    explicit small_storage(const allocator_type &alloc = allocator_type());
+
+    explicit small_storage(size_type n, const allocator_type &alloc = allocator_type());
+
+    size_type size(void) const;
+
+    size_type max_size(void) const;
+
+    iterator begin(void);
+
+    const_iterator begin(void) const;
+
+    iterator end(void);
+
+    const_iterator end(void) const;
+
+    reference operator[](size_type n);
+
+    const_reference operator[](size_type n) const;
+
+    allocator_type get_allocator(void) const;
+
+    // requests of at most N elements use the buffer
+    // note that allocate does *not* automatically call deallocate
+    void allocate(size_type n);
+
+    // returns to the buffer
+    void deallocate(void);
+
+    void swap(small_storage &x);
+
+    void default_construct_n(iterator first, size_type n);
+
+    void uninitialized_fill_n(iterator first, size_type n, const value_type &value);
+
+    template<typename InputIterator>
+    iterator uninitialized_copy(InputIterator first, InputIterator last, iterator result);
+
+    template<typename System, typename InputIterator>
+    iterator uninitialized_copy(thrust::execution_policy<System> &from_system,
+                                InputIterator first,
+                                InputIterator last,
+                                iterator result);
+
+    template<typename InputIterator, typename Size>
+    iterator uninitialized_copy_n(InputIterator first, Size n, iterator result);
+
+    template<typename System, typename InputIterator, typename Size>
+    iterator uninitialized_copy_n(thrust::execution_policy<System> &from_system,
+                                  InputIterator first,
+                                  Size n,
+                                  iterator result);
+
+    void destroy(iterator first, iterator last);
+
+  private:
+    // the elements are constructed through the heap storage's allocator
+    // wherever they live
+    heap_storage m_heap;
+
+    bool m_in_buffer;
+
+    union
+    {
+      char        m_bytes[N * sizeof(T)];
+      long double m_long_double;
+      long long   m_long_long;
+      void       *m_pointer;
+    };
+
+    T *buffer(void);
+
+    const T *buffer(void) const;
+
+    // disallow copy and assignment
+    small_storage(const small_storage &x);
+    small_storage &operator=(const small_storage &x);
+}; // end small_storage
+
+
+// vector_base<T, small_buffer_allocator<T,N,Alloc> > uses small_storage
+template<typename T, std::size_t N, typename Alloc>
+  struct vector_storage<T, small_buffer_allocator<T,N,Alloc> >
+{
+  typedef small_storage<T,N,Alloc> type;
+};
+
+} // end detail
+
+
+// a small_buffer_allocator grows as its underlying allocator does
+template<typename T, std::size_t N, typename Alloc>
+  struct vector_growth_factor<thrust::detail::small_buffer_allocator<T,N,Alloc> >
+    : vector_growth_factor<Alloc>
+{};
+
+
+template<typename T, std::size_t N, typename Alloc>
+void swap(detail::small_storage<T,N,Alloc> &lhs, detail::small_storage<T,N,Alloc> &rhs);
+
+} // end thrust
+
+#include <thrust/detail/small_storage.inl>
+
@@ -0,0 +1,242 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/small_storage.h>
+#include <thrust/detail/swap.h>
+#include <cstring>
+
+namespace thrust
+{
+
+namespace detail
+{
+
+template<typename T, std::size_t N, typename Alloc>
+  small_storage<T,N,Alloc>
+    ::small_storage(const allocator_type &alloc)
+      :m_heap(alloc),
+       m_in_buffer(true)
+{
+  ;
+} // end small_storage::small_storage()
+
+template<typename T, std::size_t N, typename Alloc>
+  small_storage<T,N,Alloc>
+    ::small_storage(size_type n, const allocator_type &alloc)
+      :m_heap(alloc),
+       m_in_buffer(true)
+{
+  allocate(n);
+} // end small_storage::small_storage()
+
+template<typename T, std::size_t N, typename Alloc>
+  T *small_storage<T,N,Alloc>
+    ::buffer(void)
+{
+  return reinterpret_cast<T*>(m_bytes);
+} // end small_storage::buffer()
+
+template<typename T, std::size_t N, typename Alloc>
+  const T *small_storage<T,N,Alloc>
+    ::buffer(void) const
+{
+  return reinterpret_cast<const T*>(m_bytes);
+} // end small_storage::buffer()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::size_type
+    small_storage<T,N,Alloc>
+      ::size(void) const
+{
+  return m_in_buffer ? N : m_heap.size();
+} // end small_storage::size()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::size_type
+    small_storage<T,N,Alloc>
+      ::max_size(void) const
+{
+  return m_heap.max_size();
+} // end small_storage::max_size()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::iterator
+    small_storage<T,N,Alloc>
+      ::begin(void)
+{
+  return m_in_buffer ? iterator(pointer(buffer())) : m_heap.begin();
+} // end small_storage::begin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::const_iterator
+    small_storage<T,N,Alloc>
+      ::begin(void) const
+{
+  return m_in_buffer ? const_iterator(const_pointer(buffer())) : m_heap.begin();
+} // end small_storage::begin()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::iterator
+    small_storage<T,N,Alloc>
+      ::end(void)
+{
+  return begin() + size();
+} // end small_storage::end()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::const_iterator
+    small_storage<T,N,Alloc>
+      ::end(void) const
+{
+  return begin() + size();
+} // end small_storage::end()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::reference
+    small_storage<T,N,Alloc>
+      ::operator[](size_type n)
+{
+  return begin()[n];
+} // end small_storage::operator[]()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::const_reference
+    small_storage<T,N,Alloc>
+      ::operator[](size_type n) const
+{
+  return begin()[n];
+} // end small_storage::operator[]()
+
+template<typename T, std::size_t N, typename Alloc>
+  typename small_storage<T,N,Alloc>::allocator_type
+    small_storage<T,N,Alloc>
+      ::get_allocator(void) const
+{
+  return allocator_type(m_heap.get_allocator());
+} // end small_storage::get_allocator()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_storage<T,N,Alloc>
+    ::allocate(size_type n)
+{
+  if(n > N)
+  {
+    m_heap.allocate(n);
+    m_in_buffer = false;
+  } // end if
+  else
+  {
+    m_in_buffer = true;
+  } // end else
+} // end small_storage::allocate()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_storage<T,N,Alloc>
+    ::deallocate(void)
+{
+  m_heap.deallocate();
+  m_in_buffer = true;
+} // end small_storage::deallocate()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_storage<T,N,Alloc>
+    ::swap(small_storage &x)
+{
+  // the buffers stay where they are, so exchange their contents
+  if(m_in_buffer || x.m_in_buffer)
+  {
+    char temp[sizeof(m_bytes)];
+
+    std::memcpy(temp,      m_bytes,   sizeof(m_bytes));
+    std::memcpy(m_bytes,   x.m_bytes, sizeof(m_bytes));
+    std::memcpy(x.m_bytes, temp,      sizeof(m_bytes));
+  } // end if
+
+  m_heap.swap(x.m_heap);
+
+  thrust::swap(m_in_buffer, x.m_in_buffer);
+} // end small_storage::swap()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_storage<T,N,Alloc>
+    ::default_construct_n(iterator first, size_type n)
+{
+  m_heap.default_construct_n(first, n);
+} // end small_storage::default_construct_n()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_storage<T,N,Alloc>
+    ::uninitialized_fill_n(iterator first, size_type n, const value_type &x)
+{
+  m_heap.uninitialized_fill_n(first, n, x);
+} // end small_storage::uninitialized_fill_n()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename InputIterator>
+    typename small_storage<T,N,Alloc>::iterator
+      small_storage<T,N,Alloc>
+        ::uninitialized_copy(InputIterator first, InputIterator last, iterator result)
+{
+  return m_heap.uninitialized_copy(first, last, result);
+} // end small_storage::uninitialized_copy()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename System, typename InputIterator>
+    typename small_storage<T,N,Alloc>::iterator
+      small_storage<T,N,Alloc>
+        ::uninitialized_copy(thrust::execution_policy<System> &from_system, InputIterator first, InputIterator last, iterator result)
+{
+  return m_heap.uninitialized_copy(from_system, first, last, result);
+} // end small_storage::uninitialized_copy()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename InputIterator, typename Size>
+    typename small_storage<T,N,Alloc>::iterator
+      small_storage<T,N,Alloc>
+        ::uninitialized_copy_n(InputIterator first, Size n, iterator result)
+{
+  return m_heap.uninitialized_copy_n(first, n, result);
+} // end small_storage::uninitialized_copy_n()
+
+template<typename T, std::size_t N, typename Alloc>
+  template<typename System, typename InputIterator, typename Size>
+    typename small_storage<T,N,Alloc>::iterator
+      small_storage<T,N,Alloc>
+        ::uninitialized_copy_n(thrust::execution_policy<System> &from_system, InputIterator first, Size n, iterator result)
+{
+  return m_heap.uninitialized_copy_n(from_system, first, n, result);
+} // end small_storage::uninitialized_copy_n()
+
+template<typename T, std::size_t N, typename Alloc>
+  void small_storage<T,N,Alloc>
+    ::destroy(iterator first, iterator last)
+{
+  m_heap.destroy(first, last);
+} // end small_storage::destroy()
+
+} // end detail
+
+template<typename T, std::size_t N, typename Alloc>
+void swap(detail::small_storage<T,N,Alloc> &lhs, detail::small_storage<T,N,Alloc> &rhs)
+{
+  lhs.swap(rhs);
+} // end swap()
+
+} // end thrust
+
@@ -92,6 +92,36 @@ OutputIterator unique_copy(const thrust::detail::execution_policy_base<DerivedPo
 } // end unique_copy()
 
 
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename ForwardIterator>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last)
+{
+  using thrust::system::detail::generic::unique_count;
+  return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last);
+} // end unique_count()
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               BinaryPredicate binary_pred)
+{
+  using thrust::system::detail::generic::unique_count;
+  return unique_count(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, binary_pred);
+} // end unique_count()
+
+
 __thrust_exec_check_disable__
 template<typename DerivedPolicy,
          typename ForwardIterator1,
@@ -236,6 +266,38 @@ template<typename InputIterator,
 } // end unique_copy()
 
 
+template<typename ForwardIterator>
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(ForwardIterator first,
+               ForwardIterator last)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<ForwardIterator>::type System;
+
+  System system;
+
+  return thrust::unique_count(select_system(system), first, last);
+} // end unique_count()
+
+
+template<typename ForwardIterator,
+         typename BinaryPredicate>
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(ForwardIterator first,
+               ForwardIterator last,
+               BinaryPredicate binary_pred)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<ForwardIterator>::type System;
+
+  System system;
+
+  return thrust::unique_count(select_system(system), first, last, binary_pred);
+} // end unique_count()
+
+
 template<typename ForwardIterator1,
          typename ForwardIterator2>
   thrust::pair<ForwardIterator1,ForwardIterator2>
@@ -27,19 +27,74 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/contiguous_storage.h>
+#include <thrust/detail/no_init.h>
 #include <vector>
+#include <cstddef>
 
 namespace thrust
 {
 
+/*! \addtogroup containers Containers
+ *  \{
+ */
+
+/*! \p vector_growth_factor gives the factor by which the capacity of a vector
+ *  using the allocator \p Alloc grows when an insertion must reallocate, as
+ *  the ratio <tt>numerator / denominator</tt>. The default doubles the
+ *  capacity. A smaller factor wastes less memory on vectors which grow
+ *  slowly, at the cost of more frequent reallocation.
+ *
+ *  Specialize \p vector_growth_factor to change the growth of every vector
+ *  which uses a particular allocator:
+ *
+ *  \code
+ *  #include <thrust/host_vector.h>
+ *
+ *  template<typename T> struct my_allocator : std::allocator<T> { ... };
+ *
+ *  namespace thrust
+ *  {
+ *
+ *  // grow by half
+ *  template<typename T>
+ *    struct vector_growth_factor<my_allocator<T> >
+ *  {
+ *    static const std::size_t numerator   = 3;
+ *    static const std::size_t denominator = 2;
+ *  };
+ *
+ *  }
+ *
+ *  thrust::host_vector<int, my_allocator<int> > vec;
+ *  \endcode
+ *
+ *  \p numerator must not be less than \p denominator.
+ */
+template<typename Alloc>
+  struct vector_growth_factor
+{
+  static const std::size_t numerator   = 2;
+  static const std::size_t denominator = 1;
+};
+
+/*! \}
+ */
+
 namespace detail
 {
 
+// the storage from which a vector_base with allocator Alloc allocates its elements
+template<typename T, typename Alloc>
+  struct vector_storage
+{
+  typedef thrust::detail::contiguous_storage<T,Alloc> type;
+};
+
 template<typename T, typename Alloc>
   class vector_base
 {
   private:
-    typedef thrust::detail::contiguous_storage<T,Alloc> storage_type;
+    typedef typename vector_storage<T,Alloc>::type storage_type;
 
   public:
     // typedefs
@@ -75,6 +130,13 @@ template<typename T, typename Alloc>
      */
     explicit vector_base(size_type n, const value_type &value);
 
+    /*! This constructor creates a vector_base whose elements are left
+     *  uninitialized if their type has a trivial default constructor, and
+     *  are default-constructed otherwise.
+     *  \param n The number of elements to create.
+     */
+    vector_base(size_type n, no_init_t);
+
     /*! Copy constructor copies from an exemplar vector_base.
      *  \param v The vector_base to copy.
      */
@@ -165,6 +227,17 @@ template<typename T, typename Alloc>
      */
     void resize(size_type new_size, const value_type &x);
 
+    /*! \brief Resizes this vector_base to the specified number of elements
+     *         without initializing new elements.
+     *  \param new_size Number of elements this vector_base should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method behaves like <tt>resize(new_size)</tt>, except that new
+     *  elements are left uninitialized if their type has a trivial default
+     *  constructor.
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector_base.
      */
     size_type size(void) const;
@@ -433,7 +506,7 @@ template<typename T, typename Alloc>
     template<typename ForwardIterator>
       void range_init(ForwardIterator first, ForwardIterator last, thrust::random_access_traversal_tag);
 
-    void default_init(size_type n);
+    void default_init(size_type n, bool initialize = true);
 
     void fill_init(size_type n, const T &x);
 
@@ -446,7 +519,11 @@ template<typename T, typename Alloc>
       void insert_dispatch(iterator position, InputIteratorOrIntegralType n, InputIteratorOrIntegralType x, true_type);
 
     // this method appends n default-constructed elements at the end
-    void append(size_type n);
+    void append(size_type n, bool initialize = true);
+
+    // this method default constructs n elements at position, or leaves them
+    // uninitialized when the caller allows it and T is trivially constructible
+    void construct_new_elements(iterator position, size_type n, bool initialize);
 
     // this method performs insertion from a fill value
     void fill_insert(iterator position, size_type n, const T &x);
@@ -478,6 +555,10 @@ template<typename T, typename Alloc>
     // this method performs assignment from a fill value
     void fill_assign(size_type n, const T &x);
 
+    // this method returns the capacity to reallocate to when at least
+    // required elements must fit
+    size_type grown_capacity(size_type required) const;
+
     // this method allocates new storage and construct copies the given range
     template<typename ForwardIterator>
     void allocate_and_copy(size_type requested_size,
@@ -27,6 +27,7 @@
 #include <thrust/advance.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/minmax.h>
+#include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
 
@@ -65,6 +66,15 @@ template<typename T, typename Alloc>
   fill_init(n,value);
 } // end vector_base::vector_base()
 
+template<typename T, typename Alloc>
+  vector_base<T,Alloc>
+    ::vector_base(size_type n, no_init_t)
+      :m_storage(),
+       m_size(0)
+{
+  default_init(n, false);
+} // end vector_base::vector_base()
+
 template<typename T, typename Alloc>
   vector_base<T,Alloc>
     ::vector_base(const vector_base &v)
@@ -163,14 +173,14 @@ template<typename T, typename Alloc>
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
-    ::default_init(size_type n)
+    ::default_init(size_type n, bool initialize)
 {
   if(n > 0)
   {
     m_storage.allocate(n);
     m_size = n;
 
-    m_storage.default_construct_n(begin(), size());
+    construct_new_elements(begin(), size(), initialize);
   } // end if
 } // end vector_base::default_init()
 
@@ -278,6 +288,22 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::resize()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::resize(size_type new_size, no_init_t)
+{
+  if(new_size < size())
+  {
+    iterator new_end = begin();
+    thrust::advance(new_end, new_size);
+    erase(new_end, end());
+  } // end if
+  else
+  {
+    append(new_size - size(), false);
+  } // end else
+} // end vector_base::resize()
+
 template<typename T, typename Alloc>
   typename vector_base<T,Alloc>::size_type
     vector_base<T,Alloc>
@@ -560,8 +586,8 @@ template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::swap(vector_base &v)
 {
-  thrust::swap(m_storage,  v.m_storage);
-  thrust::swap(m_size,     v.m_size);
+  m_storage.swap(v.m_storage);
+  thrust::swap(m_size, v.m_size);
 } // end vector_base::swap()
 
 template<typename T, typename Alloc>
@@ -719,14 +745,8 @@ template<typename T, typename Alloc>
     {
       const size_type old_size = size();
 
-      // compute the new capacity after the allocation
-      size_type new_capacity = old_size + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (old_size, num_new_elements);
-
       // allocate exponentially larger new storage
-      new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
-
-      // do not exceed maximum storage
-      new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+      size_type new_capacity = grown_capacity(old_size + num_new_elements);
 
       if(new_capacity > max_size())
       {
@@ -773,7 +793,7 @@ template<typename T, typename Alloc>
 
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
-    ::append(size_type n)
+    ::append(size_type n, bool initialize)
 {
   if(n != 0)
   {
@@ -782,7 +802,7 @@ template<typename T, typename Alloc>
       // we've got room for all of them
 
       // default construct new elements at the end of the vector
-      m_storage.default_construct_n(end(), n);
+      construct_new_elements(end(), n, initialize);
 
       // extend the size
       m_size += n;
@@ -791,14 +811,8 @@ template<typename T, typename Alloc>
     {
       const size_type old_size = size();
 
-      // compute the new capacity after the allocation
-      size_type new_capacity = old_size + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (old_size, n);
-
       // allocate exponentially larger new storage
-      new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
-
-      // do not exceed maximum storage
-      new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+      size_type new_capacity = grown_capacity(old_size + n);
 
       // create new storage
       storage_type new_storage(new_capacity);
@@ -812,7 +826,7 @@ template<typename T, typename Alloc>
         new_end = m_storage.uninitialized_copy(begin(), end(), new_storage.begin());
 
         // construct new elements to insert
-        m_storage.default_construct_n(new_end, n);
+        construct_new_elements(new_end, n, initialize);
         new_end += n;
       } // end try
       catch(...)
@@ -835,6 +849,17 @@ template<typename T, typename Alloc>
   } // end if
 } // end vector_base::append()
 
+template<typename T, typename Alloc>
+  void vector_base<T,Alloc>
+    ::construct_new_elements(iterator position, size_type n, bool initialize)
+{
+  // elements with a nontrivial constructor must always be constructed
+  if(initialize || !thrust::detail::has_trivial_constructor<T>::value)
+  {
+    m_storage.default_construct_n(position, n);
+  } // end if
+} // end vector_base::construct_new_elements()
+
 template<typename T, typename Alloc>
   void vector_base<T,Alloc>
     ::fill_insert(iterator position, size_type n, const T &x)
@@ -887,14 +912,8 @@ template<typename T, typename Alloc>
     {
       const size_type old_size = size();
 
-      // compute the new capacity after the allocation
-      size_type new_capacity = old_size + thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION (old_size, n);
-
       // allocate exponentially larger new storage
-      new_capacity = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, 2 * capacity());
-
-      // do not exceed maximum storage
-      new_capacity = thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(new_capacity, max_size());
+      size_type new_capacity = grown_capacity(old_size + n);
 
       if(new_capacity > max_size())
       {
@@ -1065,6 +1084,27 @@ template<typename T, typename Alloc>
   } // end else
 } // end vector_base::fill_assign()
 
+template<typename T, typename Alloc>
+  typename vector_base<T,Alloc>::size_type
+    vector_base<T,Alloc>
+      ::grown_capacity(size_type required) const
+{
+  typedef thrust::vector_growth_factor<Alloc> growth;
+
+  THRUST_STATIC_ASSERT(growth::numerator >= growth::denominator);
+
+  // storage which is not growing, e.g. that of a new copy, needs only what is required
+  if(required <= capacity())
+  {
+    return required;
+  } // end if
+
+  size_type result = thrust::max THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(capacity() * growth::numerator / growth::denominator, required);
+
+  // do not exceed maximum storage
+  return thrust::min THRUST_PREVENT_MACRO_SUBSTITUTION <size_type>(result, max_size());
+} // end vector_base::grown_capacity()
+
 template<typename T, typename Alloc>
   template<typename ForwardIterator>
     void vector_base<T,Alloc>
@@ -1079,10 +1119,7 @@ template<typename T, typename Alloc>
   } // end if
 
   // allocate exponentially larger new storage
-  size_type allocated_size = thrust::max<size_type>(requested_size, 2 * capacity());
-
-  // do not exceed maximum storage
-  allocated_size = thrust::min<size_type>(allocated_size, max_size());
+  size_type allocated_size = grown_capacity(requested_size);
 
   if(requested_size > allocated_size)
   {
@@ -0,0 +1,288 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file histogram.h
+ *  \brief Counting the elements of a range which fall into each of a set of bins
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+
+namespace thrust
+{
+
+
+/*! \addtogroup reductions
+ *  \{
+ */
+
+/*! \addtogroup counting
+ *  \ingroup reductions
+ *  \{
+ */
+
+
+/*! \p histogram_even counts the samples of <tt>[first, last)</tt> which fall
+ *  into each of \p num_bins bins of equal width spanning
+ *  <tt>[lower_level, upper_level)</tt>, and writes the counts to
+ *  <tt>[histogram, histogram + num_bins)</tt>. A sample \c x falls into bin
+ *  <tt>(x - lower_level) * num_bins / (upper_level - lower_level)</tt>.
+ *  Samples outside of <tt>[lower_level, upper_level)</tt>, including NaN,
+ *  are not counted.
+ *
+ *  \p histogram_even visits each sample once and does not modify or copy
+ *  the input, unlike a histogram computed by sorting the samples.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the bin counts.
+ *  \param num_bins The number of bins.
+ *  \param lower_level The lower bound, inclusive, of the first bin.
+ *  \param upper_level The upper bound, exclusive, of the last bin.
+ *  \return <tt>histogram + num_bins</tt>
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p T.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *  \tparam T is an arithmetic type.
+ *
+ *  \pre When \p T is an integral type, <tt>(upper_level - lower_level) * num_bins</tt> shall be representable
+ *       by \c unsigned \c long \c long.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to
+ *  count latencies in bins 10 milliseconds wide using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float latencies[8] = {3.5f, 12.0f, 47.0f, 18.5f, 5.0f, 39.9f, 50.0f, 11.0f};
+ *  int histogram[5];
+ *
+ *  thrust::histogram_even(thrust::host, latencies, latencies + 8, histogram, 5, 0.0f, 50.0f);
+ *
+ *  // histogram is now {2, 3, 0, 1, 1}
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ *  \see \p count_if
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename Size,
+         typename T>
+__host__ __device__
+  RandomAccessIterator histogram_even(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      Size num_bins,
+                                      T lower_level,
+                                      T upper_level);
+
+
+/*! \p histogram_even counts the samples of <tt>[first, last)</tt> which fall
+ *  into each of \p num_bins bins of equal width spanning
+ *  <tt>[lower_level, upper_level)</tt>, and writes the counts to
+ *  <tt>[histogram, histogram + num_bins)</tt>. A sample \c x falls into bin
+ *  <tt>(x - lower_level) * num_bins / (upper_level - lower_level)</tt>.
+ *  Samples outside of <tt>[lower_level, upper_level)</tt>, including NaN,
+ *  are not counted.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param histogram The beginning of the bin counts.
+ *  \param num_bins The number of bins.
+ *  \param lower_level The lower bound, inclusive, of the first bin.
+ *  \param upper_level The upper bound, exclusive, of the last bin.
+ *  \return <tt>histogram + num_bins</tt>
+ *
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p T.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is an integral type.
+ *  \tparam Size is an integral type.
+ *  \tparam T is an arithmetic type.
+ *
+ *  \pre When \p T is an integral type, <tt>(upper_level - lower_level) * num_bins</tt> shall be representable
+ *       by \c unsigned \c long \c long.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_even to
+ *  count integers in bins of width 4.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  ...
+ *  int samples[8] = {0, 3, 4, 9, 15, 16, -1, 7};
+ *  int histogram[4];
+ *
+ *  thrust::histogram_even(samples, samples + 8, histogram, 4, 0, 16);
+ *
+ *  // histogram is now {2, 2, 1, 1}
+ *  \endcode
+ *
+ *  \see \p histogram_range
+ *  \see \p count_if
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename Size,
+         typename T>
+  RandomAccessIterator histogram_even(InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      Size num_bins,
+                                      T lower_level,
+                                      T upper_level);
+
+
+/*! \p histogram_range counts the samples of <tt>[first, last)</tt> which fall
+ *  into each of the bins delimited by the sorted levels
+ *  <tt>[levels_first, levels_last)</tt>, and writes the counts to
+ *  <tt>[histogram, histogram + (levels_last - levels_first) - 1)</tt>.
+ *  A sample \c x falls into bin \c i when <tt>levels_first[i] <= x</tt> and
+ *  <tt>x < levels_first[i + 1]</tt>. Samples outside of the levels are not
+ *  counted.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param levels_first The beginning of the levels.
+ *  \param levels_last The end of the levels.
+ *  \param histogram The beginning of the bin counts.
+ *  \return The end of the bin counts.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator2 is mutable,
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted with respect to \c operator<.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to
+ *  count latencies in bins of increasing width using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  float latencies[8] = {3.5f, 12.0f, 47.0f, 18.5f, 5.0f, 399.0f, 500.0f, 11.0f};
+ *  float levels[4] = {0.0f, 10.0f, 100.0f, 500.0f};
+ *  int histogram[3];
+ *
+ *  thrust::histogram_range(thrust::host, latencies, latencies + 8, levels, levels + 4, histogram);
+ *
+ *  // histogram is now {2, 4, 1}
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ *  \see \p upper_bound
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 histogram_range(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                        InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 levels_first,
+                                        RandomAccessIterator1 levels_last,
+                                        RandomAccessIterator2 histogram);
+
+
+/*! \p histogram_range counts the samples of <tt>[first, last)</tt> which fall
+ *  into each of the bins delimited by the sorted levels
+ *  <tt>[levels_first, levels_last)</tt>, and writes the counts to
+ *  <tt>[histogram, histogram + (levels_last - levels_first) - 1)</tt>.
+ *  A sample \c x falls into bin \c i when <tt>levels_first[i] <= x</tt> and
+ *  <tt>x < levels_first[i + 1]</tt>. Samples outside of the levels are not
+ *  counted.
+ *
+ *  \param first The beginning of the samples.
+ *  \param last The end of the samples.
+ *  \param levels_first The beginning of the levels.
+ *  \param levels_last The end of the levels.
+ *  \param histogram The beginning of the bin counts.
+ *  \return The end of the bin counts.
+ *
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator1's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>.
+ *  \tparam RandomAccessIterator2 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator2 is mutable,
+ *          and \p RandomAccessIterator2's \c value_type is an integral type.
+ *
+ *  \pre <tt>[levels_first, levels_last)</tt> shall be sorted with respect to \c operator<.
+ *
+ *  The following code snippet demonstrates how to use \p histogram_range to
+ *  count integers in bins of varying width.
+ *
+ *  \code
+ *  #include <thrust/histogram.h>
+ *  ...
+ *  int samples[8] = {0, 3, 4, 9, 15, 16, -1, 7};
+ *  int levels[4] = {0, 1, 8, 16};
+ *  int histogram[3];
+ *
+ *  thrust::histogram_range(samples, samples + 8, levels, levels + 4, histogram);
+ *
+ *  // histogram is now {1, 3, 2}
+ *  \endcode
+ *
+ *  \see \p histogram_even
+ *  \see \p upper_bound
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  RandomAccessIterator2 histogram_range(InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 levels_first,
+                                        RandomAccessIterator1 levels_last,
+                                        RandomAccessIterator2 histogram);
+
+
+/*! \} // end counting
+ *  \} // end reductions
+ */
+
+
+} // end namespace thrust
+
+#include <thrust/detail/histogram.inl>
+
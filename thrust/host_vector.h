@@ -94,6 +94,17 @@ template<typename T, typename Alloc = std::allocator<T> >
     explicit host_vector(size_type n, const value_type &value)
       :Parent(n,value) {}
 
+    /*! This constructor creates a \p host_vector with the given size
+     *  whose elements are left uninitialized if their type has a trivial
+     *  default constructor.
+     *  \param n The number of elements to initially create.
+     *
+     *  \see thrust::no_init
+     */
+    __host__
+    host_vector(size_type n, no_init_t)
+      :Parent(n,no_init) {}
+
     /*! Copy constructor copies from an exemplar \p host_vector.
      *  \param v The \p host_vector to copy.
      */
@@ -197,6 +208,19 @@ template<typename T, typename Alloc = std::allocator<T> >
      */
     void resize(size_type new_size, const value_type &x = value_type());
 
+    /*! \brief Resizes this vector to the specified number of elements
+     *         without initializing new elements.
+     *  \param new_size Number of elements this vector should contain.
+     *  \throw std::length_error If n exceeds max_size().
+     *
+     *  This method behaves like <tt>resize(new_size)</tt>, except that new
+     *  elements are left uninitialized if their type has a trivial default
+     *  constructor.
+     *
+     *  \see thrust::no_init
+     */
+    void resize(size_type new_size, no_init_t);
+
     /*! Returns the number of elements in this vector.
      */
     size_type size(void) const;
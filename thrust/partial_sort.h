@@ -0,0 +1,1088 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file partial_sort.h
+ *  \brief Functions for selecting and sorting the first elements of a range
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+namespace thrust
+{
+
+
+/*! \addtogroup sorting
+ *  \ingroup algorithms
+ *  \{
+ */
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  the element at \p nth is the element which would occupy that position if
+ *  <tt>[first, last)</tt> were sorted, every element of <tt>[first, nth)</tt>
+ *  is not greater than \c *nth, and every element of <tt>[nth, last)</tt> is
+ *  not less than \c *nth. The order within each side is unspecified.
+ *
+ *  \p nth_element takes linear time on average, and is much cheaper than
+ *  \p sort when only one order statistic, such as the median, is needed.
+ *  If \p nth is \p last, \p nth_element has no effect.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the median of a sequence of integers using the \p thrust::host execution
+ *  policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 7, 3, 6, 2, 4};
+ *  thrust::nth_element(thrust::host, A, A + N / 2, A + N);
+ *  // A[3] is now 4, A[0], A[1] and A[2] are {1, 2, 3} in some order,
+ *  // and A[4], A[5] and A[6] are {5, 6, 7} in some order
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/nth_element.html
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  the element at \p nth is the element which would occupy that position if
+ *  <tt>[first, last)</tt> were sorted, every element of <tt>[first, nth)</tt>
+ *  is not greater than \c *nth, and every element of <tt>[nth, last)</tt> is
+ *  not less than \c *nth. The order within each side is unspecified.
+ *
+ *  This version of \p nth_element compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the median of a sequence of integers.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {5, 1, 7, 3, 6, 2, 4};
+ *  thrust::nth_element(A, A + N / 2, A + N);
+ *  // A[3] is now 4
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/nth_element.html
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename RandomAccessIterator>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  the element at \p nth is the element which would occupy that position if
+ *  <tt>[first, last)</tt> were sorted by \p comp, no element of
+ *  <tt>[first, nth)</tt> is ordered after \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is ordered before \c *nth.
+ *
+ *  This version of \p nth_element compares objects using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  The following code snippet demonstrates how to use \p nth_element to find
+ *  the second largest of a sequence of integers using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::nth_element(thrust::host, A, A + 1, A + N, thrust::greater<int>());
+ *  // A[1] is now 7 and A[0] is 8
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/nth_element.html
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void nth_element(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp);
+
+
+/*! \p nth_element rearranges the elements of <tt>[first, last)</tt> so that
+ *  the element at \p nth is the element which would occupy that position if
+ *  <tt>[first, last)</tt> were sorted by \p comp, no element of
+ *  <tt>[first, nth)</tt> is ordered after \c *nth, and no element of
+ *  <tt>[nth, last)</tt> is ordered before \c *nth.
+ *
+ *  This version of \p nth_element compares objects using a function object
+ *  \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param nth The position of the element to select.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::nth_element(A, A + 1, A + N, thrust::greater<int>());
+ *  // A[1] is now 7 and A[0] is 8
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/nth_element.html
+ *  \see \p partial_sort
+ *  \see \p sort
+ */
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void nth_element(RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest
+ *  elements in ascending order. The order of the elements of
+ *  <tt>[middle, last)</tt> is unspecified. Like \p sort, \p partial_sort is
+ *  not stable.
+ *
+ *  \p partial_sort is much cheaper than \p sort when <tt>middle - first</tt>
+ *  is small relative to <tt>last - first</tt>.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the sorted prefix.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p partial_sort to
+ *  sort the three smallest of a sequence of integers using the
+ *  \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  thrust::partial_sort(thrust::host, A, A + 3, A + N);
+ *  // A is now {1, 2, 4, x, x, x}, where the x are {5, 7, 8} in some order
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort.html
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> smallest
+ *  elements in ascending order. The order of the elements of
+ *  <tt>[middle, last)</tt> is unspecified.
+ *
+ *  This version of \p partial_sort compares objects using \c operator<.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the sorted prefix.
+ *  \param last The end of the sequence.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  thrust::partial_sort(A, A + 3, A + N);
+ *  // A is now {1, 2, 4, x, x, x}
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort.html
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename RandomAccessIterator>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> elements which
+ *  are ordered first by \p comp, in the order of \p comp. The order of the
+ *  elements of <tt>[middle, last)</tt> is unspecified.
+ *
+ *  This version of \p partial_sort compares objects using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the sorted prefix.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  thrust::partial_sort(thrust::host, A, A + 2, A + N, thrust::greater<int>());
+ *  // A is now {8, 7, x, x, x, x}
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort.html
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void partial_sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp);
+
+
+/*! \p partial_sort rearranges the elements of <tt>[first, last)</tt> so that
+ *  <tt>[first, middle)</tt> holds the <tt>middle - first</tt> elements which
+ *  are ordered first by \p comp, in the order of \p comp. The order of the
+ *  elements of <tt>[middle, last)</tt> is unspecified.
+ *
+ *  This version of \p partial_sort compares objects using a function object
+ *  \p comp.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param middle The end of the sorted prefix.
+ *  \param last The end of the sequence.
+ *  \param comp Comparison operator.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  thrust::partial_sort(A, A + 2, A + N, thrust::greater<int>());
+ *  // A is now {8, 7, x, x, x, x}
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort.html
+ *  \see \p nth_element
+ *  \see \p partial_sort_copy
+ */
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void partial_sort(RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp);
+
+
+/*! \p partial_sort_copy copies the <tt>m = min(last - first, result_last - result_first)</tt>
+ *  smallest elements of <tt>[first, last)</tt> to <tt>[result_first, result_first + m)</tt>
+ *  in ascending order. The input is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return <tt>result_first + m</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>
+ *          and is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  int B[3];
+ *  int *end = thrust::partial_sort_copy(thrust::host, A, A + N, B, B + 3);
+ *  // B is now {1, 2, 4} and end is B + 3
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort_copy.html
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator>
+__host__ __device__
+  RandomAccessIterator partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last);
+
+
+/*! \p partial_sort_copy copies the <tt>m = min(last - first, result_last - result_first)</tt>
+ *  smallest elements of <tt>[first, last)</tt> to <tt>[result_first, result_first + m)</tt>
+ *  in ascending order. The input is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using \c operator<.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \return <tt>result_first + m</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>
+ *          and is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  int B[3];
+ *  thrust::partial_sort_copy(A, A + N, B, B + 3);
+ *  // B is now {1, 2, 4}
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort_copy.html
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator>
+  RandomAccessIterator partial_sort_copy(InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last);
+
+
+/*! \p partial_sort_copy copies the <tt>m = min(last - first, result_last - result_first)</tt>
+ *  elements of <tt>[first, last)</tt> which are ordered first by \p comp to
+ *  <tt>[result_first, result_first + m)</tt>, in the order of \p comp. The
+ *  input is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using a function
+ *  object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result_first + m</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type and to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  int B[2];
+ *  thrust::partial_sort_copy(thrust::host, A, A + N, B, B + 2, thrust::greater<int>());
+ *  // B is now {8, 7}
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort_copy.html
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator partial_sort_copy(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp);
+
+
+/*! \p partial_sort_copy copies the <tt>m = min(last - first, result_last - result_first)</tt>
+ *  elements of <tt>[first, last)</tt> which are ordered first by \p comp to
+ *  <tt>[result_first, result_first + m)</tt>, in the order of \p comp. The
+ *  input is not modified.
+ *
+ *  This version of \p partial_sort_copy compares objects using a function
+ *  object \p comp.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param result_first The beginning of the output sequence.
+ *  \param result_last The end of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result_first + m</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type and to \p RandomAccessIterator's \c value_type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result_first, result_last)</tt> shall not overlap.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  int B[2];
+ *  thrust::partial_sort_copy(A, A + N, B, B + 2, thrust::greater<int>());
+ *  // B is now {8, 7}
+ *  \endcode
+ *
+ *  \see http://www.sgi.com/tech/stl/partial_sort_copy.html
+ *  \see \p partial_sort
+ *  \see \p top_k
+ */
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  RandomAccessIterator partial_sort_copy(InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp);
+
+
+/*! \p top_k copies the <tt>m = min(k, last - first)</tt> largest elements of
+ *  <tt>[first, last)</tt> to <tt>[result, result + m)</tt> in descending
+ *  order. The input is not modified. \p top_k is equivalent to
+ *  \p partial_sort_copy with <tt>thrust::greater</tt>, and is much cheaper
+ *  than sorting the whole input when \p k is small.
+ *
+ *  This version of \p top_k compares objects using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \return <tt>result + m</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>
+ *          and is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + m)</tt> shall not overlap.
+ *
+ *  The following code snippet demonstrates how to use \p top_k to find the
+ *  three highest scores using the \p thrust::device execution policy for
+ *  parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/device_vector.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  thrust::device_vector<float> scores(6);
+ *  scores[0] = 0.5f; scores[1] = 0.9f; scores[2] = 0.1f;
+ *  scores[3] = 0.7f; scores[4] = 0.3f; scores[5] = 0.8f;
+ *
+ *  thrust::device_vector<float> best(3);
+ *
+ *  thrust::top_k(thrust::device, scores.begin(), scores.end(), 3, best.begin());
+ *  // best is now {0.9f, 0.8f, 0.7f}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+__host__ __device__
+  RandomAccessIterator top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result);
+
+
+/*! \p top_k copies the <tt>m = min(k, last - first)</tt> largest elements of
+ *  <tt>[first, last)</tt> to <tt>[result, result + m)</tt> in descending
+ *  order. The input is not modified.
+ *
+ *  This version of \p top_k compares objects using \c operator<.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \return <tt>result + m</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>
+ *          and is convertible to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + m)</tt> shall not overlap.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  int B[3];
+ *  thrust::top_k(A, A + N, 3, B);
+ *  // B is now {8, 7, 5}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template<typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+  RandomAccessIterator top_k(InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result);
+
+
+/*! \p top_k copies the <tt>m = min(k, last - first)</tt> elements of
+ *  <tt>[first, last)</tt> which are ordered first by \p comp to
+ *  <tt>[result, result + m)</tt>, in the order of \p comp. The input is not
+ *  modified. With <tt>thrust::greater</tt>, the default, these are the
+ *  largest elements; with <tt>thrust::less</tt> they are the smallest.
+ *
+ *  This version of \p top_k compares objects using a function object \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result + m</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type and to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + m)</tt> shall not overlap.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  int B[2];
+ *  thrust::top_k(thrust::host, A, A + N, 2, B, thrust::less<int>());
+ *  // B is now {1, 2}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator top_k(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp);
+
+
+/*! \p top_k copies the <tt>m = min(k, last - first)</tt> elements of
+ *  <tt>[first, last)</tt> which are ordered first by \p comp to
+ *  <tt>[result, result + m)</tt>, in the order of \p comp. The input is not
+ *  modified.
+ *
+ *  This version of \p top_k compares objects using a function object \p comp.
+ *
+ *  \param first The beginning of the input sequence.
+ *  \param last The end of the input sequence.
+ *  \param k The number of elements to select.
+ *  \param result The beginning of the output sequence.
+ *  \param comp Comparison operator.
+ *  \return <tt>result + m</tt>.
+ *
+ *  \tparam InputIterator is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type and to \p RandomAccessIterator's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \pre The ranges <tt>[first, last)</tt> and <tt>[result, result + m)</tt> shall not overlap.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 6;
+ *  int A[N] = {5, 1, 8, 4, 2, 7};
+ *  int B[2];
+ *  thrust::top_k(A, A + N, 2, B, thrust::less<int>());
+ *  // B is now {1, 2}
+ *  \endcode
+ *
+ *  \see \p top_k_by_key
+ *  \see \p partial_sort_copy
+ */
+template<typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  RandomAccessIterator top_k(InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp);
+
+
+/*! \p top_k_by_key copies the <tt>m = min(k, keys_last - keys_first)</tt>
+ *  largest keys of <tt>[keys_first, keys_last)</tt> to
+ *  <tt>[keys_result, keys_result + m)</tt> in descending order, and the
+ *  value corresponding to each to the same position of <tt>values_result</tt>.
+ *  The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using \c operator<.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is <tt>keys_result + m</tt>
+ *          and <tt>p.second</tt> is <tt>values_result + m</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>
+ *          and is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1 is mutable.
+ *  \tparam RandomAccessIterator2 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  The following code snippet demonstrates how to use \p top_k_by_key to
+ *  find the ids of the two highest scores using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 5;
+ *  float scores[N] = {0.5f, 0.9f, 0.1f, 0.7f, 0.3f};
+ *  int   ids[N]    = {  10,   11,   12,   13,   14};
+ *
+ *  float best_scores[2];
+ *  int   best_ids[2];
+ *
+ *  thrust::top_k_by_key(thrust::host, scores, scores + N, ids, 2, best_scores, best_ids);
+ *  // best_scores is now {0.9f, 0.7f} and best_ids is {11, 13}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result);
+
+
+/*! \p top_k_by_key copies the <tt>m = min(k, keys_last - keys_first)</tt>
+ *  largest keys of <tt>[keys_first, keys_last)</tt> to
+ *  <tt>[keys_result, keys_result + m)</tt> in descending order, and the
+ *  value corresponding to each to the same position of <tt>values_result</tt>.
+ *  The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using \c operator<.
+ *
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is <tt>keys_result + m</tt>
+ *          and <tt>p.second</tt> is <tt>values_result + m</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/LessThanComparable.html">LessThan Comparable</a>
+ *          and is convertible to \p RandomAccessIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1 is mutable.
+ *  \tparam RandomAccessIterator2 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  ...
+ *  const int N = 5;
+ *  float scores[N] = {0.5f, 0.9f, 0.1f, 0.7f, 0.3f};
+ *  int   ids[N]    = {  10,   11,   12,   13,   14};
+ *
+ *  float best_scores[2];
+ *  int   best_ids[2];
+ *
+ *  thrust::top_k_by_key(scores, scores + N, ids, 2, best_scores, best_ids);
+ *  // best_scores is now {0.9f, 0.7f} and best_ids is {11, 13}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result);
+
+
+/*! \p top_k_by_key copies the <tt>m = min(k, keys_last - keys_first)</tt>
+ *  keys of <tt>[keys_first, keys_last)</tt> which are ordered first by
+ *  \p comp to <tt>[keys_result, keys_result + m)</tt>, in the order of
+ *  \p comp, and the value corresponding to each to the same position of
+ *  <tt>values_result</tt>. The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using a function object
+ *  \p comp.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is <tt>keys_result + m</tt>
+ *          and <tt>p.second</tt> is <tt>values_result + m</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam InputIterator1 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type and to \p RandomAccessIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1 is mutable.
+ *  \tparam RandomAccessIterator2 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 5;
+ *  float scores[N] = {0.5f, 0.9f, 0.1f, 0.7f, 0.3f};
+ *  int   ids[N]    = {  10,   11,   12,   13,   14};
+ *
+ *  float worst_scores[2];
+ *  int   worst_ids[2];
+ *
+ *  thrust::top_k_by_key(thrust::host, scores, scores + N, ids, 2, worst_scores, worst_ids, thrust::less<float>());
+ *  // worst_scores is now {0.1f, 0.3f} and worst_ids is {12, 14}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp);
+
+
+/*! \p top_k_by_key copies the <tt>m = min(k, keys_last - keys_first)</tt>
+ *  keys of <tt>[keys_first, keys_last)</tt> which are ordered first by
+ *  \p comp to <tt>[keys_result, keys_result + m)</tt>, in the order of
+ *  \p comp, and the value corresponding to each to the same position of
+ *  <tt>values_result</tt>. The inputs are not modified.
+ *
+ *  This version of \p top_k_by_key compares keys using a function object
+ *  \p comp.
+ *
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param k The number of elements to select.
+ *  \param keys_result The beginning of the output key sequence.
+ *  \param values_result The beginning of the output value sequence.
+ *  \param comp Comparison operator.
+ *  \return A \p pair \c p such that <tt>p.first</tt> is <tt>keys_result + m</tt>
+ *          and <tt>p.second</tt> is <tt>values_result + m</tt>.
+ *
+ *  \tparam InputIterator1 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator1's \c value_type is convertible to \p StrictWeakOrdering's
+ *          \c first_argument_type and \c second_argument_type and to \p RandomAccessIterator1's \c value_type.
+ *  \tparam InputIterator2 is a model of <a href="http://www.sgi.com/tech/stl/InputIterator.html">Input Iterator</a>,
+ *          and \p InputIterator2's \c value_type is convertible to \p RandomAccessIterator2's \c value_type.
+ *  \tparam Size is an integral type.
+ *  \tparam RandomAccessIterator1 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator1 is mutable.
+ *  \tparam RandomAccessIterator2 is a model of <a href="http://www.sgi.com/tech/stl/RandomAccessIterator.html">Random Access Iterator</a>
+ *          and \p RandomAccessIterator2 is mutable.
+ *  \tparam StrictWeakOrdering is a model of <a href="http://www.sgi.com/tech/stl/StrictWeakOrdering.html">Strict Weak Ordering</a>.
+ *
+ *  \pre The input ranges shall not overlap either output range.
+ *
+ *  \code
+ *  #include <thrust/partial_sort.h>
+ *  #include <thrust/functional.h>
+ *  ...
+ *  const int N = 5;
+ *  float scores[N] = {0.5f, 0.9f, 0.1f, 0.7f, 0.3f};
+ *  int   ids[N]    = {  10,   11,   12,   13,   14};
+ *
+ *  float worst_scores[2];
+ *  int   worst_ids[2];
+ *
+ *  thrust::top_k_by_key(scores, scores + N, ids, 2, worst_scores, worst_ids, thrust::less<float>());
+ *  // worst_scores is now {0.1f, 0.3f} and worst_ids is {12, 14}
+ *  \endcode
+ *
+ *  \see \p top_k
+ *  \see \p sort_by_key
+ */
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp);
+
+
+/*! \} // end sorting
+ */
+
+
+} // end namespace thrust
+
+#include <thrust/detail/partial_sort.inl>
+
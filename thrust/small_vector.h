@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file small_vector.h
+ *  \brief A dynamically-sizable array of elements which reside in the "host"
+ *         memory space and keep a few elements inside the vector itself
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <memory>
+#include <thrust/detail/vector_base.h>
+#include <thrust/detail/small_storage.h>
+#include <thrust/host_vector.h>
+#include <cstddef>
+#include <vector>
+
+namespace thrust
+{
+
+/*! \addtogroup container_classes Container Classes
+ *  \addtogroup host_containers Host Containers
+ *  \ingroup container_classes
+ *  \{
+ */
+
+/*! A \p small_vector is a \p host_vector which stores up to \p N elements
+ *  inside the \p small_vector object itself, and allocates storage from
+ *  \p Alloc only when it grows beyond \p N elements. Programs which build many
+ *  short vectors avoid an allocation per vector this way.
+ *
+ *  The capacity of a \p small_vector is never less than \p N. When it must
+ *  reallocate, its capacity grows by <tt>vector_growth_factor<Alloc></tt>.
+ *
+ *  \p small_vector exchanges the elements it stores internally byte by byte
+ *  when it is swapped, so \p T must be trivially copyable.
+ *
+ *  \code
+ *  #include <thrust/small_vector.h>
+ *  ...
+ *  // room for 8 ints without allocating
+ *  thrust::small_vector<int, 8> vec;
+ *
+ *  for(int i = 0; i < 8; ++i)
+ *    vec.push_back(i);
+ *
+ *  // the 9th element moves the vector to the heap
+ *  vec.push_back(8);
+ *  \endcode
+ *
+ *  \see host_vector
+ *  \see vector_growth_factor
+ */
+template<typename T, std::size_t N, typename Alloc = std::allocator<T> >
+  class small_vector
+    : public detail::vector_base<T, detail::small_buffer_allocator<T,N,Alloc> >
+{
+  private:
+    typedef detail::vector_base<T, detail::small_buffer_allocator<T,N,Alloc> > Parent;
+
+  public:
+    /*! \cond
+     */
+    typedef typename Parent::size_type  size_type;
+    typedef typename Parent::value_type value_type;
+    /*! \endcond
+     */
+
+    /*! The number of elements this \p small_vector stores without allocating.
+     */
+    static const std::size_t inline_capacity = N;
+
+    /*! This constructor creates an empty \p small_vector.
+     */
+    __host__
+    small_vector(void)
+      :Parent() {}
+
+    /*! This constructor creates a \p small_vector with the given
+     *  size.
+     *  \param n The number of elements to initially create.
+     */
+    __host__
+    explicit small_vector(size_type n)
+      :Parent(n) {}
+
+    /*! This constructor creates a \p small_vector with copies
+     *  of an exemplar element.
+     *  \param n The number of elements to initially create.
+     *  \param value An element to copy.
+     */
+    __host__
+    explicit small_vector(size_type n, const value_type &value)
+      :Parent(n,value) {}
+
+    /*! This constructor creates a \p small_vector with \p n elements
+     *  which are left uninitialized.
+     *  \param n The number of elements to initially create.
+     */
+    __host__
+    small_vector(size_type n, no_init_t)
+      :Parent(n,no_init) {}
+
+    /*! Copy constructor copies from an exemplar \p small_vector.
+     *  \param v The \p small_vector to copy.
+     */
+    __host__
+    small_vector(const small_vector &v)
+      :Parent(v) {}
+
+  #if __cplusplus >= 201103L
+    /*! Move constructor moves the elements of another \p small_vector.
+     *  \param v The \p small_vector to move.
+     */
+     __host__
+    small_vector(small_vector &&v)
+      :Parent(std::move(v)) {}
+  #endif
+
+    /*! Assign operator copies from an exemplar \p small_vector.
+     *  \param v The \p small_vector to copy.
+     */
+    __host__
+    small_vector &operator=(const small_vector &v)
+    { Parent::operator=(v); return *this; }
+
+  #if __cplusplus >= 201103L
+    /*! Move assign operator moves the elements of another \p small_vector.
+     *  \param v The \p small_vector to move.
+     */
+     __host__
+     small_vector &operator=(small_vector &&v)
+     { Parent::operator=(std::move(v)); return *this; }
+  #endif
+
+    /*! Copy constructor copies from an exemplar \p host_vector.
+     *  \param v The \p host_vector to copy.
+     */
+    template<typename OtherT, typename OtherAlloc>
+    __host__
+    small_vector(const host_vector<OtherT,OtherAlloc> &v)
+      :Parent(v) {}
+
+    /*! Assign operator copies from an exemplar \p host_vector.
+     *  \param v The \p host_vector to copy.
+     */
+    template<typename OtherT, typename OtherAlloc>
+    __host__
+    small_vector &operator=(const host_vector<OtherT,OtherAlloc> &v)
+    { Parent::operator=(v); return *this; }
+
+    /*! Copy constructor copies from an exemplar <tt>std::vector</tt>.
+     *  \param v The <tt>std::vector</tt> to copy.
+     */
+    template<typename OtherT, typename OtherAlloc>
+    __host__
+    small_vector(const std::vector<OtherT,OtherAlloc> &v)
+      :Parent(v) {}
+
+    /*! Assign operator copies from an exemplar <tt>std::vector</tt>.
+     *  \param v The <tt>std::vector</tt> to copy.
+     */
+    template<typename OtherT, typename OtherAlloc>
+    __host__
+    small_vector &operator=(const std::vector<OtherT,OtherAlloc> &v)
+    { Parent::operator=(v); return *this;}
+
+    /*! This constructor builds a \p small_vector from a range.
+     *  \param first The beginning of the range.
+     *  \param last The end of the range.
+     */
+    template<typename InputIterator>
+    __host__
+    small_vector(InputIterator first, InputIterator last)
+      :Parent(first, last) {}
+}; // end small_vector
+
+/*! \}
+ */
+
+} // end thrust
+
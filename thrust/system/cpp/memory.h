@@ -25,6 +25,11 @@
 #include <thrust/memory.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/allocator/malloc_allocator.h>
+#include <thrust/detail/allocator/aligned_allocator.h>
+#include <thrust/detail/allocator/page_locked_allocator.h>
+#include <thrust/detail/allocator/caching_allocator.h>
+#include <thrust/detail/allocator/arena.h>
+#include <thrust/detail/allocator/allocation_profiler.h>
 #include <ostream>
 
 namespace thrust
@@ -387,6 +392,269 @@ template<typename T>
   inline ~allocator() {}
 }; // end allocator
 
+
+/*! \p cpp::aligned_allocator allocates storage for the \p cpp system aligned to
+ *  \p Alignment bytes, which must be a power of two. The default of 64 bytes
+ *  places the first element of a container on a cache line boundary, so that
+ *  vectorized loops do not begin with a misaligned head.
+ *
+ *  \code
+ *  #include <thrust/system/cpp/vector.h>
+ *  ...
+ *  thrust::cpp::vector<float, thrust::cpp::aligned_allocator<float> > v(n);
+ *  \endcode
+ *
+ *  \see huge_page_allocator
+ */
+template<typename T, std::size_t Alignment = 64>
+  struct aligned_allocator
+    : thrust::detail::aligned_allocator<
+        T,
+        tag,
+        pointer<T>,
+        Alignment
+      >
+{
+  /*! The \p rebind metafunction provides the type of an \p aligned_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p aligned_allocator.
+     */
+    typedef aligned_allocator<U,Alignment> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  inline aligned_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  inline aligned_allocator(const aligned_allocator &) {}
+
+  /*! Constructor from other \p aligned_allocator has no effect.
+   */
+  template<typename U>
+  inline aligned_allocator(const aligned_allocator<U,Alignment> &) {}
+}; // end aligned_allocator
+
+
+/*! \p cpp::huge_page_allocator allocates storage for the \p cpp system aligned
+ *  to 2 MB and, on Linux, advises the kernel to back them with transparent
+ *  huge pages. For arrays of many megabytes this removes most TLB misses from
+ *  bandwidth-bound algorithms such as \p reduce and \p transform. Blocks
+ *  smaller than 2 MB are aligned to 64 bytes instead, so that small
+ *  temporaries do not each occupy a huge page. Where transparent huge pages
+ *  are unavailable it behaves like an \p aligned_allocator with 2 MB alignment.
+ *
+ *  \p huge_page_allocator may also provide the temporary storage of an algorithm:
+ *
+ *  \code
+ *  #include <thrust/system/cpp/memory.h>
+ *  #include <thrust/system/cpp/execution_policy.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::cpp::huge_page_allocator<char> alloc;
+ *
+ *  thrust::sort(thrust::cpp::par(alloc), keys.begin(), keys.end());
+ *  \endcode
+ */
+template<typename T>
+  struct huge_page_allocator
+    : aligned_allocator<T, std::size_t(2) << 20>
+{
+  /*! The \p rebind metafunction provides the type of a \p huge_page_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p huge_page_allocator.
+     */
+    typedef huge_page_allocator<U> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  inline huge_page_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  inline huge_page_allocator(const huge_page_allocator &) : aligned_allocator<T, std::size_t(2) << 20>() {}
+
+  /*! Constructor from other \p huge_page_allocator has no effect.
+   */
+  template<typename U>
+  inline huge_page_allocator(const huge_page_allocator<U> &) : aligned_allocator<T, std::size_t(2) << 20>() {}
+}; // end huge_page_allocator
+
+
+/*! \p cpp::page_locked_allocator allocates storage for the \p cpp system
+ *  whose pages are all faulted in when it is allocated and, on Linux, locked
+ *  into memory with \p mlock. Algorithms
+ *  operating on the storage therefore never stall on a page fault, which
+ *  makes the first call on a freshly allocated vector as fast as later ones.
+ *
+ *  Locking is best effort: blocks smaller than 16 pages, and blocks which
+ *  would exceed the process's locked memory limit (\c RLIMIT_MEMLOCK), are
+ *  faulted in but not locked. Unlike \p thrust::cuda::experimental::pinned_allocator,
+ *  \p page_locked_allocator does not depend on the CUDA runtime.
+ *
+ *  \code
+ *  #include <thrust/system/cpp/memory.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<float, thrust::cpp::page_locked_allocator<float> > v(n);
+ *  \endcode
+ */
+template<typename T>
+  struct page_locked_allocator
+    : thrust::detail::page_locked_allocator<
+        T,
+        tag,
+        pointer<T>
+      >
+{
+  /*! The \p rebind metafunction provides the type of a \p page_locked_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p page_locked_allocator.
+     */
+    typedef page_locked_allocator<U> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  inline page_locked_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  inline page_locked_allocator(const page_locked_allocator &) {}
+
+  /*! Constructor from other \p page_locked_allocator has no effect.
+   */
+  template<typename U>
+  inline page_locked_allocator(const page_locked_allocator<U> &) {}
+}; // end page_locked_allocator
+
+
+/*! \p caching_allocator is a thread-safe allocator of temporary storage for
+ *  the host systems. It keeps deallocated blocks in bins of similar size and
+ *  reuses them for later requests, which avoids the cost of obtaining fresh
+ *  memory from the system on every algorithm invocation.
+ *
+ *  The following code snippet demonstrates how to use \p caching_allocator
+ *  as the source of an algorithm's temporary storage:
+ *
+ *  \code
+ *  #include <thrust/system/cpp/memory.h>
+ *  #include <thrust/system/cpp/execution_policy.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::cpp::caching_allocator pool;
+ *
+ *  for(int i = 0; i < 1000; ++i)
+ *  {
+ *    // every iteration after the first reuses the same temporary storage
+ *    thrust::sort_by_key(thrust::cpp::par(pool), keys.begin(), keys.end(), values.begin());
+ *  }
+ *
+ *  thrust::cpp::caching_allocator_statistics stats = pool.statistics();
+ *  \endcode
+ *
+ *  \see thrust::cpp::caching_allocator_statistics
+ */
+typedef thrust::detail::caching_allocator caching_allocator;
+
+
+/*! \p caching_allocator_statistics reports the hits, misses, bytes retained
+ *  and high-water mark of a \p caching_allocator.
+ */
+typedef thrust::detail::caching_allocator_statistics caching_allocator_statistics;
+
+
+/*! \p arena reserves one block of host memory up front and carves the
+ *  temporary storage of the algorithms which use it from that block, so that
+ *  a pipeline of algorithms runs without calling \p malloc. The block is
+ *  freed when the \p arena goes out of scope.
+ *
+ *  The following code snippet demonstrates a pipeline whose temporaries all
+ *  come from one arena:
+ *
+ *  \code
+ *  #include <thrust/system/cpp/memory.h>
+ *  #include <thrust/system/cpp/execution_policy.h>
+ *  #include <thrust/copy.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  thrust::cpp::arena scratch(64 << 20);
+ *
+ *  end = thrust::copy_if(thrust::cpp::par(scratch), first, last, keys.begin(), pred);
+ *  thrust::sort_by_key(thrust::cpp::par(scratch), keys.begin(), end, values.begin());
+ *  thrust::reduce_by_key(thrust::cpp::par(scratch), keys.begin(), end, values.begin(),
+ *                        unique_keys.begin(), sums.begin());
+ *
+ *  // size the arena for the next request
+ *  thrust::cpp::arena_statistics stats = scratch.statistics();
+ *  assert(stats.overflows == 0);
+ *  \endcode
+ *
+ *  \see thrust::cpp::arena_statistics
+ */
+typedef thrust::detail::arena arena;
+
+
+/*! \p arena_statistics reports the bytes in use, high-water mark and
+ *  overflows of an \p arena.
+ */
+typedef thrust::detail::arena_statistics arena_statistics;
+
+
+/*! \p allocation_profiler records the temporary allocations of the algorithms
+ *  which use it: their number, their sizes and the peak number of bytes
+ *  allocated at once.
+ *
+ *  The following code snippet demonstrates how to measure the temporary
+ *  storage of a single algorithm invocation:
+ *
+ *  \code
+ *  #include <thrust/system/cpp/memory.h>
+ *  #include <thrust/system/cpp/execution_policy.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::cpp::allocation_profiler profiler;
+ *
+ *  thrust::sort_by_key(thrust::cpp::par(profiler), keys.begin(), keys.end(), values.begin());
+ *
+ *  thrust::cpp::allocation_profile profile = profiler.profile();
+ *
+ *  // profile.peak_bytes is the scratch memory sort_by_key needed
+ *
+ *  profiler.reset();
+ *  \endcode
+ *
+ *  \see thrust::cpp::allocation_profile
+ */
+typedef thrust::detail::allocation_profiler allocation_profiler;
+
+
+/*! \p allocation_profile reports the number, sizes and peak bytes of the
+ *  allocations recorded by an \p allocation_profiler.
+ */
+typedef thrust::detail::allocation_profile allocation_profile;
+
 } // end cpp
 
 /*! \}
@@ -405,6 +673,15 @@ using thrust::system::cpp::reference;
 using thrust::system::cpp::malloc;
 using thrust::system::cpp::free;
 using thrust::system::cpp::allocator;
+using thrust::system::cpp::caching_allocator;
+using thrust::system::cpp::caching_allocator_statistics;
+using thrust::system::cpp::arena;
+using thrust::system::cpp::arena_statistics;
+using thrust::system::cpp::allocation_profiler;
+using thrust::system::cpp::allocation_profile;
+using thrust::system::cpp::aligned_allocator;
+using thrust::system::cpp::huge_page_allocator;
+using thrust::system::cpp::page_locked_allocator;
 
 } // end cpp
 
@@ -145,6 +145,27 @@ OutputIterator binary_search(thrust::execution_policy<DerivedPolicy> &exec,
                              StrictWeakOrdering comp);
 
 
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename OutputIterator>
+__host__ __device__
+OutputIterator sorted_search(thrust::execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator begin, 
+                             ForwardIterator end,
+                             InputIterator values_begin, 
+                             InputIterator values_end,
+                             OutputIterator output);
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename OutputIterator, typename StrictWeakOrdering>
+__host__ __device__
+OutputIterator sorted_search(thrust::execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator begin, 
+                             ForwardIterator end,
+                             InputIterator values_begin, 
+                             InputIterator values_end,
+                             OutputIterator output,
+                             StrictWeakOrdering comp);
+
+
 template <typename DerivedPolicy, typename ForwardIterator, typename LessThanComparable>
 __host__ __device__
 thrust::pair<ForwardIterator,ForwardIterator>
@@ -352,6 +352,35 @@ OutputIterator binary_search(thrust::execution_policy<DerivedPolicy> &exec,
 }
 
 
+template<typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename OutputIterator>
+__host__ __device__
+OutputIterator sorted_search(thrust::execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator begin, 
+                             ForwardIterator end,
+                             InputIterator values_begin, 
+                             InputIterator values_end,
+                             OutputIterator output)
+{
+  return thrust::sorted_search(exec, begin, end, values_begin, values_end, output, detail::binary_search_less());
+}
+
+
+template<typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename OutputIterator, typename StrictWeakOrdering>
+__host__ __device__
+OutputIterator sorted_search(thrust::execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator begin, 
+                             ForwardIterator end,
+                             InputIterator values_begin, 
+                             InputIterator values_end,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+  // the sortedness of the values is only an optimization opportunity,
+  // so fall back to independent searches
+  return thrust::lower_bound(exec, begin, end, values_begin, values_end, output, comp);
+}
+
+
 template<typename DerivedPolicy, typename ForwardIterator, typename LessThanComparable>
 __host__ __device__
 thrust::pair<ForwardIterator,ForwardIterator>
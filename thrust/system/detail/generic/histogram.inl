@@ -0,0 +1,130 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/transform.h>
+#include <thrust/sort.h>
+#include <thrust/binary_search.h>
+#include <thrust/adjacent_difference.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/detail/temporary_array.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+namespace histogram_detail
+{
+
+
+// counts by sorting the samples' bin indices, so that the bins are the
+// differences of the indices' upper bounds
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+__host__ __device__
+  RandomAccessIterator histogram_by_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator histogram,
+                                         BinFunction bin)
+{
+  typedef typename BinFunction::result_type Size;
+
+  const Size num_bins = bin.num_bins;
+
+  // samples outside of the bins are mapped to num_bins and sorted after the others
+  thrust::detail::temporary_array<Size,DerivedPolicy> indices(exec, thrust::distance(first, last));
+
+  thrust::transform(exec, first, last, indices.begin(), bin);
+
+  thrust::sort(exec, indices.begin(), indices.end());
+
+  thrust::upper_bound(exec,
+                      indices.begin(), indices.end(),
+                      thrust::counting_iterator<Size>(0), thrust::counting_iterator<Size>(num_bins),
+                      histogram);
+
+  thrust::adjacent_difference(exec, histogram, histogram + num_bins, histogram);
+
+  return histogram + num_bins;
+}
+
+
+} // end namespace histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename Size,
+         typename T>
+__host__ __device__
+  RandomAccessIterator histogram_even(thrust::execution_policy<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator histogram,
+                                      Size num_bins,
+                                      T lower_level,
+                                      T upper_level)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  if(num_bins <= 0) return histogram;
+
+  return histogram_detail::histogram_by_sort(exec, first, last, histogram, internal::even_bin<T,Size>(lower_level, upper_level, num_bins));
+} // end histogram_even()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  RandomAccessIterator2 histogram_range(thrust::execution_policy<DerivedPolicy> &exec,
+                                        InputIterator first,
+                                        InputIterator last,
+                                        RandomAccessIterator1 levels_first,
+                                        RandomAccessIterator1 levels_last,
+                                        RandomAccessIterator2 histogram)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size num_bins = (levels_last - levels_first) - 1;
+
+  if(num_bins <= 0) return histogram;
+
+  return histogram_detail::histogram_by_sort(exec, first, last, histogram, internal::range_bin<RandomAccessIterator1,Size>(levels_first, num_bins));
+} // end histogram_range()
+
+
+} // end namespace generic
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,258 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/generic/partial_sort.h>
+#include <thrust/partial_sort.h>
+#include <thrust/sort.h>
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/internal_functional.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace generic
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::nth_element(exec, first, nth, last, thrust::less<value_type>());
+} // end nth_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void nth_element(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator nth,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  if(nth == last) return;
+
+  // implement with sort
+  thrust::sort(exec, first, last, comp);
+} // end nth_element()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  thrust::partial_sort(exec, first, middle, last, thrust::less<value_type>());
+} // end partial_sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  void partial_sort(thrust::execution_policy<DerivedPolicy> &exec,
+                    RandomAccessIterator first,
+                    RandomAccessIterator middle,
+                    RandomAccessIterator last,
+                    StrictWeakOrdering comp)
+{
+  if(first == middle) return;
+
+  // move the middle - first smallest elements to the front, with the
+  // largest of them at middle - 1, and sort the others
+  thrust::nth_element(exec, first, middle - 1, last, comp);
+  thrust::sort(exec, first, middle - 1, comp);
+} // end partial_sort()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator>
+__host__ __device__
+  RandomAccessIterator partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type value_type;
+  return thrust::partial_sort_copy(exec, first, last, result_first, result_last, thrust::less<value_type>());
+} // end partial_sort_copy()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator partial_sort_copy(thrust::execution_policy<DerivedPolicy> &exec,
+                                         InputIterator first,
+                                         InputIterator last,
+                                         RandomAccessIterator result_first,
+                                         RandomAccessIterator result_last,
+                                         StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type             value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type        difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+  const difference_type m = result_last - result_first;
+
+  if(n <= m)
+  {
+    // every element fits in the result
+    result_last = thrust::copy(exec, first, last, result_first);
+    thrust::sort(exec, result_first, result_last, comp);
+    return result_last;
+  }
+
+  if(m == 0) return result_first;
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, first, last);
+
+  thrust::partial_sort(exec, temp.begin(), temp.begin() + m, temp.end(), comp);
+
+  return thrust::copy(exec, temp.begin(), temp.begin() + m, result_first);
+} // end partial_sort_copy()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator>
+__host__ __device__
+  RandomAccessIterator top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type value_type;
+  return thrust::top_k(exec, first, last, k, result, thrust::greater<value_type>());
+} // end top_k()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+  RandomAccessIterator top_k(thrust::execution_policy<DerivedPolicy> &exec,
+                             InputIterator first,
+                             InputIterator last,
+                             Size k,
+                             RandomAccessIterator result,
+                             StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  difference_type m = static_cast<difference_type>(k);
+
+  if(m <= 0) return result;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(n < m) m = n;
+
+  return thrust::partial_sort_copy(exec, first, last, result, result + m, comp);
+} // end top_k()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result)
+{
+  typedef typename thrust::iterator_value<InputIterator1>::type value_type;
+  return thrust::top_k_by_key(exec, keys_first, keys_last, values_first, k, keys_result, values_result, thrust::greater<value_type>());
+} // end top_k_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename Size,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    top_k_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                 InputIterator1 keys_first,
+                 InputIterator1 keys_last,
+                 InputIterator2 values_first,
+                 Size k,
+                 RandomAccessIterator1 keys_result,
+                 RandomAccessIterator2 values_result,
+                 StrictWeakOrdering comp)
+{
+  typedef thrust::tuple<InputIterator1,InputIterator2>                 iterator_tuple1;
+  typedef thrust::zip_iterator<iterator_tuple1>                        zip_iterator1;
+  typedef thrust::tuple<RandomAccessIterator1,RandomAccessIterator2>   iterator_tuple2;
+  typedef thrust::zip_iterator<iterator_tuple2>                        zip_iterator2;
+
+  zip_iterator1 zipped_first  = thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first));
+  zip_iterator1 zipped_last   = thrust::make_zip_iterator(thrust::make_tuple(keys_last, values_first));
+  zip_iterator2 zipped_result = thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result));
+
+  thrust::detail::compare_first<StrictWeakOrdering> comp_first(comp);
+
+  iterator_tuple2 result = thrust::top_k(exec, zipped_first, zipped_last, k, zipped_result, comp_first).get_iterator_tuple();
+
+  return thrust::make_pair(thrust::get<0>(result), thrust::get<1>(result));
+} // end top_k_by_key()
+
+
+} // end generic
+} // end detail
+} // end system
+} // end thrust
+
@@ -18,6 +18,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/detail/generic/tag.h>
+#include <thrust/iterator/iterator_traits.h>
 
 namespace thrust
 {
@@ -69,6 +70,26 @@ OutputIterator unique_copy(thrust::execution_policy<DerivedPolicy> &exec,
                            BinaryPredicate binary_pred);
 
 
+template<typename DerivedPolicy,
+         typename ForwardIterator>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(thrust::execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last);
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(thrust::execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               BinaryPredicate binary_pred);
+
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
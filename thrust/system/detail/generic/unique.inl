@@ -29,6 +29,7 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/internal_functional.h>
 #include <thrust/detail/copy_if.h>
+#include <thrust/count.h>
 #include <thrust/distance.h>
 #include <thrust/functional.h>
 #include <thrust/detail/range/head_flags.h>
@@ -106,6 +107,37 @@ __host__ __device__
 } // end unique_copy()
 
 
+template<typename DerivedPolicy,
+         typename ForwardIterator>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(thrust::execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last)
+{
+  typedef typename thrust::iterator_value<ForwardIterator>::type value_type;
+  return thrust::unique_count(exec, first, last, thrust::equal_to<value_type>());
+} // end unique_count()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(thrust::execution_policy<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               BinaryPredicate binary_pred)
+{
+  thrust::detail::head_flags<ForwardIterator, BinaryPredicate> stencil(first, last, binary_pred);
+
+  using namespace thrust::placeholders;
+
+  return thrust::count_if(exec, stencil.begin(), stencil.end(), _1);
+} // end unique_count()
+
+
 } // end namespace generic
 } // end namespace detail
 } // end namespace system
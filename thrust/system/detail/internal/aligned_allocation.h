@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file aligned_allocation.h
+ *  \brief Host allocation with a requested alignment and optional
+ *         transparent huge pages.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef>
+#include <cstdlib>
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+#include <malloc.h>
+#else
+#include <stdlib.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// the size of a transparent huge page on x86-64 and most other targets
+const std::size_t huge_page_size = std::size_t(2) << 20;
+
+// the alignment given instead of huge page alignment to blocks smaller than
+// a huge page, which could not be backed by one anyway
+const std::size_t small_block_alignment = 64;
+
+
+// returns num_bytes of memory aligned to alignment, which must be a power of
+// two, or null on failure. allocations aligned to a huge page are advised
+// to be backed by transparent huge pages where the operating system allows it.
+// smaller blocks requesting huge page alignment are only aligned to a cache
+// line, so that small temporaries do not each waste up to a huge page
+inline void *allocate_aligned(std::size_t num_bytes, std::size_t alignment)
+{
+  if(alignment >= huge_page_size && num_bytes < huge_page_size)
+  {
+    alignment = small_block_alignment;
+  }
+
+  // posix_memalign requires at least the alignment of a pointer
+  if(alignment < sizeof(void*))
+  {
+    alignment = sizeof(void*);
+  }
+
+  void *result = 0;
+
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+  result = ::_aligned_malloc(num_bytes, alignment);
+#else
+  if(::posix_memalign(&result, alignment, num_bytes) != 0)
+  {
+    result = 0;
+  }
+#endif
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if(result != 0 && alignment >= huge_page_size && num_bytes >= huge_page_size)
+  {
+    // this is only a hint; ignore failure on kernels without THP
+    ::madvise(result, num_bytes, MADV_HUGEPAGE);
+  }
+#endif
+
+  return result;
+}
+
+
+// ptr must have been returned by allocate_aligned
+inline void deallocate_aligned(void *ptr)
+{
+#if THRUST_HOST_COMPILER == THRUST_HOST_COMPILER_MSVC
+  ::_aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,313 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file bounded_merge_sort.h
+ *  \brief Stable merge sort kernels which use at most a caller-provided
+ *         amount of scratch storage.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_reference_cast.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace bounded_merge_sort_detail
+{
+
+
+// runs of this many elements are sorted by insertion before merging begins
+const int insertion_sort_width = 16;
+
+// a tile holds at most this many elements, so that larger inputs are divided
+// into more tiles than there are processors, each of which sorts faster
+const int max_tile_size = 1 << 20;
+
+
+template<typename RandomAccessIterator>
+void exchange(RandomAccessIterator a, RandomAccessIterator b)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  // assign through the references so that zipped ranges exchange every member
+  value_type tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+
+template<typename RandomAccessIterator>
+void reverse(RandomAccessIterator first, RandomAccessIterator last)
+{
+  for(; first < last && first < --last; ++first)
+  {
+    exchange(first, last);
+  }
+}
+
+
+template<typename RandomAccessIterator, typename StrictWeakOrdering>
+void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  if(first == last) return;
+
+  for(RandomAccessIterator i = first + 1; i < last; ++i)
+  {
+    value_type x = *i;
+
+    RandomAccessIterator j = i;
+
+    for(; j > first && comp(x, thrust::raw_reference_cast(*(j - 1))); --j)
+    {
+      *j = *(j - 1);
+    }
+
+    *j = x;
+  }
+}
+
+
+template<typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+RandomAccessIterator lower_bound(RandomAccessIterator first, RandomAccessIterator last, const T &x, StrictWeakOrdering comp)
+{
+  while(first < last)
+  {
+    RandomAccessIterator mid = first + (last - first) / 2;
+
+    if(comp(thrust::raw_reference_cast(*mid), x)) first = mid + 1;
+    else                                          last  = mid;
+  }
+
+  return first;
+}
+
+
+template<typename RandomAccessIterator, typename T, typename StrictWeakOrdering>
+RandomAccessIterator upper_bound(RandomAccessIterator first, RandomAccessIterator last, const T &x, StrictWeakOrdering comp)
+{
+  while(first < last)
+  {
+    RandomAccessIterator mid = first + (last - first) / 2;
+
+    if(comp(x, thrust::raw_reference_cast(*mid))) last  = mid;
+    else                                          first = mid + 1;
+  }
+
+  return first;
+}
+
+
+} // end bounded_merge_sort_detail
+
+
+// exchanges [first, middle) and [middle, last) in place and returns the new
+// position of the element at first
+template<typename RandomAccessIterator>
+RandomAccessIterator rotate(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+{
+  bounded_merge_sort_detail::reverse(first, middle);
+  bounded_merge_sort_detail::reverse(middle, last);
+  bounded_merge_sort_detail::reverse(first, last);
+
+  return first + (last - middle);
+}
+
+
+// stably merges the adjacent sorted ranges [first, middle) and [middle, last)
+// using at most buffer_size elements of storage at buffer. when neither range
+// fits in the buffer, the merge is split in two around a rotation
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void buffered_merge(RandomAccessIterator1 first,
+                    RandomAccessIterator1 middle,
+                    RandomAccessIterator1 last,
+                    RandomAccessIterator2 buffer,
+                    Size buffer_size,
+                    StrictWeakOrdering comp)
+{
+  namespace ns = bounded_merge_sort_detail;
+
+  Size len1 = middle - first;
+  Size len2 = last - middle;
+
+  if(len1 == 0 || len2 == 0) return;
+
+  // the ranges are already in order
+  if(!comp(thrust::raw_reference_cast(*middle), thrust::raw_reference_cast(*(middle - 1)))) return;
+
+  if(len1 + len2 == 2)
+  {
+    ns::exchange(first, middle);
+  }
+  else if(len1 <= len2 && len1 <= buffer_size)
+  {
+    // move the first range aside and merge forward
+    RandomAccessIterator2 buffer_end = buffer;
+    for(RandomAccessIterator1 i = first; i < middle; ++i, ++buffer_end) *buffer_end = *i;
+
+    RandomAccessIterator2 i = buffer;
+    RandomAccessIterator1 j = middle;
+    RandomAccessIterator1 result = first;
+
+    for(; i < buffer_end && j < last; ++result)
+    {
+      if(comp(thrust::raw_reference_cast(*j), thrust::raw_reference_cast(*i))) { *result = *j; ++j; }
+      else                                                                    { *result = *i; ++i; }
+    }
+
+    for(; i < buffer_end; ++i, ++result) *result = *i;
+  }
+  else if(len2 <= buffer_size)
+  {
+    // move the second range aside and merge backward
+    RandomAccessIterator2 buffer_end = buffer;
+    for(RandomAccessIterator1 j = middle; j < last; ++j, ++buffer_end) *buffer_end = *j;
+
+    RandomAccessIterator1 i = middle;
+    RandomAccessIterator2 j = buffer_end;
+    RandomAccessIterator1 result = last;
+
+    for(; i > first && j > buffer;)
+    {
+      if(comp(thrust::raw_reference_cast(*(j - 1)), thrust::raw_reference_cast(*(i - 1)))) { --i; *--result = *i; }
+      else                                                                                { --j; *--result = *j; }
+    }
+
+    for(; j > buffer;) { --j; *--result = *j; }
+  }
+  else
+  {
+    RandomAccessIterator1 cut1, cut2;
+
+    if(len1 > len2)
+    {
+      cut1 = first + len1 / 2;
+      cut2 = ns::lower_bound(middle, last, thrust::raw_reference_cast(*cut1), comp);
+    }
+    else
+    {
+      cut2 = middle + len2 / 2;
+      cut1 = ns::upper_bound(first, middle, thrust::raw_reference_cast(*cut2), comp);
+    }
+
+    RandomAccessIterator1 new_middle = thrust::system::detail::internal::rotate(cut1, middle, cut2);
+
+    buffered_merge(first, cut1, new_middle, buffer, buffer_size, comp);
+    buffered_merge(new_middle, cut2, last, buffer, buffer_size, comp);
+  }
+}
+
+
+// the number of tiles into which n elements are divided for num_procs processors
+template<typename Size>
+Size bounded_sort_num_tiles(Size n, Size num_procs)
+{
+  const Size tile_size = bounded_merge_sort_detail::max_tile_size;
+
+  const Size min_tiles = (n + tile_size - 1) / tile_size;
+
+  return min_tiles > num_procs ? min_tiles : num_procs;
+}
+
+
+// stably sorts [first, last) using at most buffer_size elements of storage at buffer
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+void buffered_merge_sort(RandomAccessIterator1 first,
+                         RandomAccessIterator1 last,
+                         RandomAccessIterator2 buffer,
+                         Size buffer_size,
+                         StrictWeakOrdering comp)
+{
+  namespace ns = bounded_merge_sort_detail;
+
+  const Size n = last - first;
+
+  for(Size i = 0; i < n; i += ns::insertion_sort_width)
+  {
+    Size end = (n - i < Size(ns::insertion_sort_width)) ? n : i + ns::insertion_sort_width;
+
+    ns::insertion_sort(first + i, first + end, comp);
+  }
+
+  for(Size width = ns::insertion_sort_width; width < n; width *= 2)
+  {
+    for(Size i = 0; i + width < n; i += 2 * width)
+    {
+      Size end = (n - i - width < width) ? n : i + 2 * width;
+
+      buffered_merge(first + i, first + i + width, first + end, buffer, buffer_size, comp);
+    }
+  }
+}
+
+
+// the pieces of a merge of two adjacent sorted runs which begins at first.
+// piece j of the merge output takes lhs[j + 1] - lhs[j] elements from the
+// first run and the rest of [diag[j], diag[j + 1]) from the second.
+//
+// interleave_pieces rearranges pieces [lo, hi), which are stored as the first
+// run's parts followed by the second run's, so that each piece's parts are
+// adjacent and in output position. the pieces may then be merged independently
+template<typename RandomAccessIterator,
+         typename Size,
+         typename Rotate>
+void interleave_pieces(RandomAccessIterator first,
+                       const Size *diag,
+                       const Size *lhs,
+                       Size lo,
+                       Size hi,
+                       Rotate &rotate)
+{
+  if(hi - lo < 2) return;
+
+  Size mid = lo + (hi - lo) / 2;
+
+  // the second run's parts of pieces [lo, mid) are exchanged with the first
+  // run's parts of pieces [mid, hi)
+  RandomAccessIterator base = first + diag[lo];
+
+  Size lhs_lo_mid  = lhs[mid] - lhs[lo];
+  Size lhs_lo_hi   = lhs[hi]  - lhs[lo];
+  Size rhs_lo_mid  = (diag[mid] - lhs[mid]) - (diag[lo] - lhs[lo]);
+
+  rotate(base + lhs_lo_mid, base + lhs_lo_hi, base + lhs_lo_hi + rhs_lo_mid);
+
+  interleave_pieces(first, diag, lhs, lo, mid, rotate);
+  interleave_pieces(first, diag, lhs, mid, hi, rotate);
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
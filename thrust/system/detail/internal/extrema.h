@@ -0,0 +1,206 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+/*! \file extrema.h
+ *  \brief Per-tile building blocks of the fused min_element, max_element
+ *         and minmax_element used by the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/functional.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/detail/is_trivial_iterator.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace extrema_detail
+{
+
+
+// the extrema of a block are found with this many independent accumulators,
+// which the compiler keeps in vector registers
+const int num_lanes = 8;
+
+// a tile is scanned in blocks of this many elements. only the block holding
+// the extremum is scanned a second time, to find its first occurrence
+const int block_size = 1024;
+
+
+// arithmetic elements of contiguous storage ordered by the default comparator
+// are reduced directly, rather than zipped with their indices
+template<typename Iterator, typename BinaryPredicate>
+struct use_fused_extrema
+  : thrust::detail::and_<
+      thrust::detail::is_trivial_iterator<Iterator>,
+      thrust::detail::is_arithmetic<typename thrust::iterator_value<Iterator>::type>,
+      thrust::detail::is_same<BinaryPredicate, thrust::less<typename thrust::iterator_value<Iterator>::type> >
+    >
+{};
+
+
+// the smallest and largest elements of a range and the indices of their
+// first occurrences
+template<typename T, typename Size>
+struct extrema
+{
+  T    min_value;
+  Size min_index;
+  T    max_value;
+  Size max_index;
+};
+
+
+// finds the smallest and/or largest of data[0, n), n > 0
+template<bool FindMin, bool FindMax, typename T, typename Size>
+void block_extrema(const T *data, Size n, T &min_value, T &max_value)
+{
+  T mins[num_lanes];
+  T maxs[num_lanes];
+
+  for(int j = 0; j < num_lanes; ++j)
+  {
+    mins[j] = data[0];
+    maxs[j] = data[0];
+  }
+
+  Size i = 0;
+
+  for(; i + num_lanes <= n; i += num_lanes)
+  {
+    for(int j = 0; j < num_lanes; ++j)
+    {
+      const T x = data[i + j];
+
+      if(FindMin) mins[j] = x < mins[j] ? x : mins[j];
+      if(FindMax) maxs[j] = maxs[j] < x ? x : maxs[j];
+    }
+  }
+
+  for(; i < n; ++i)
+  {
+    const T x = data[i];
+
+    if(FindMin) mins[0] = x < mins[0] ? x : mins[0];
+    if(FindMax) maxs[0] = maxs[0] < x ? x : maxs[0];
+  }
+
+  min_value = mins[0];
+  max_value = maxs[0];
+
+  for(int j = 1; j < num_lanes; ++j)
+  {
+    if(FindMin) min_value = mins[j] < min_value ? mins[j] : min_value;
+    if(FindMax) max_value = max_value < maxs[j] ? maxs[j] : max_value;
+  }
+}
+
+
+// returns the index of the first element of data equivalent to value,
+// which must be one of them
+template<typename T, typename Size>
+Size find_equivalent(const T *data, const T &value)
+{
+  Size i = 0;
+
+  // equivalence rather than equality, which a NaN value would never satisfy
+  while(data[i] < value || value < data[i])
+  {
+    ++i;
+  }
+
+  return i;
+}
+
+
+// finds the extrema of data[begin, end), begin < end. ties are broken
+// in favor of the first occurrence, as the generic implementations do
+template<bool FindMin, bool FindMax, typename T, typename Size>
+extrema<T,Size> tile_extrema(const T *data, Size begin, Size end)
+{
+  extrema<T,Size> result;
+  result.min_value = data[begin];
+  result.max_value = data[begin];
+
+  Size min_block = begin;
+  Size max_block = begin;
+
+  for(Size block_begin = begin; block_begin < end; block_begin += block_size)
+  {
+    const Size n = (end - block_begin) < Size(block_size) ? (end - block_begin) : Size(block_size);
+
+    T min_value, max_value;
+    block_extrema<FindMin,FindMax>(data + block_begin, n, min_value, max_value);
+
+    // only a strictly better block replaces an earlier one
+    if(FindMin && min_value < result.min_value)
+    {
+      result.min_value = min_value;
+      min_block = block_begin;
+    }
+
+    if(FindMax && result.max_value < max_value)
+    {
+      result.max_value = max_value;
+      max_block = block_begin;
+    }
+  }
+
+  result.min_index = min_block;
+  result.max_index = max_block;
+
+  if(FindMin) result.min_index += find_equivalent<T,Size>(data + min_block, result.min_value);
+  if(FindMax) result.max_index += find_equivalent<T,Size>(data + max_block, result.max_value);
+
+  return result;
+}
+
+
+// combines the extrema of a tile with those of the tiles preceding it
+template<bool FindMin, bool FindMax, typename T, typename Size>
+void merge_extrema(extrema<T,Size> &result, const extrema<T,Size> &next)
+{
+  // the earlier tile wins ties
+  if(FindMin && next.min_value < result.min_value)
+  {
+    result.min_value = next.min_value;
+    result.min_index = next.min_index;
+  }
+
+  if(FindMax && result.max_value < next.max_value)
+  {
+    result.max_value = next.max_value;
+    result.max_index = next.max_index;
+  }
+}
+
+
+} // end namespace extrema_detail
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,117 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file first_touch.h
+ *  \brief Page allocation helpers for NUMA-aware first-touch placement.
+ *
+ *  Operating systems which place pages on the NUMA node of the thread which
+ *  first writes them (as Linux does by default) can be steered by allocating
+ *  memory which has never been touched and then writing one byte of each page
+ *  from the thread which will later process it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <cstddef>
+#include <cstdlib>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+inline std::size_t page_size()
+{
+#if defined(__linux__)
+  static const long result = ::sysconf(_SC_PAGESIZE);
+  return result > 0 ? static_cast<std::size_t>(result) : 4096;
+#else
+  return 4096;
+#endif
+}
+
+
+// returns num_bytes of memory none of whose pages have been touched,
+// or null on failure
+inline void *allocate_untouched(std::size_t num_bytes)
+{
+#if defined(__linux__)
+  // small blocks are not worth a mapping of their own
+  if(num_bytes >= 16 * page_size())
+  {
+    void *result = ::mmap(0, num_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    return result == MAP_FAILED ? 0 : result;
+  }
+#endif
+
+  // elsewhere, rely on large blocks from malloc being fresh pages
+  return std::malloc(num_bytes);
+}
+
+
+// num_bytes must match the request to allocate_untouched
+inline void deallocate_untouched(void *ptr, std::size_t num_bytes)
+{
+#if defined(__linux__)
+  if(num_bytes >= 16 * page_size())
+  {
+    ::munmap(ptr, num_bytes);
+    return;
+  }
+#endif
+
+  std::free(ptr);
+}
+
+
+// writes a byte to each page which begins in [first, last), and to first
+// itself, so that every page overlapping [first, last) is placed by the
+// calling thread unless another thread reached it earlier
+inline void touch_pages(char *first, char *last)
+{
+  if(first == last) return;
+
+  const std::size_t page = page_size();
+
+  const std::size_t n = last - first;
+
+  *first = 0;
+
+  // continue from the next page boundary
+  for(std::size_t i = page - reinterpret_cast<std::size_t>(first) % page; i < n; i += page)
+  {
+    first[i] = 0;
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
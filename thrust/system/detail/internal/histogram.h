@@ -0,0 +1,213 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file histogram.h
+ *  \brief Bin functions and the binning loop shared by histogram implementations.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/type_traits.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace histogram_detail
+{
+
+
+// maps the samples of [lower_level, upper_level) to num_bins bins of equal
+// width, and all other samples to num_bins
+template<typename T, typename Size>
+struct even_bin
+{
+  typedef Size result_type;
+
+  T lower_level;
+  T upper_level;
+  Size num_bins;
+
+  __host__ __device__
+  even_bin(const T &lower_level, const T &upper_level, Size num_bins)
+    : lower_level(lower_level), upper_level(upper_level), num_bins(num_bins)
+  {}
+
+  __host__ __device__
+  Size operator()(const T &x) const
+  {
+    // this also rejects NaN
+    if(!(lower_level <= x && x < upper_level))
+    {
+      return num_bins;
+    }
+
+    return bin(x, thrust::detail::is_integral<T>());
+  }
+
+  __host__ __device__
+  Size bin(const T &x, thrust::detail::true_type) const
+  {
+    // unsigned differences cannot overflow when the levels are far apart
+    typedef unsigned long long U;
+
+    const U offset = static_cast<U>(x) - static_cast<U>(lower_level);
+    const U width  = static_cast<U>(upper_level) - static_cast<U>(lower_level);
+    const U bins   = static_cast<U>(num_bins);
+
+    // the product overflows only for 64-bit samples spread over a wide range
+    if(offset <= ~U(0) / bins)
+    {
+      return static_cast<Size>(offset * bins / width);
+    }
+
+    return static_cast<Size>(mul_div(offset, bins, width));
+  }
+
+  // returns floor(a * b / c) for a < c without overflow, by accumulating a
+  // once per bit of b while keeping the remainder below c
+  __host__ __device__
+  static unsigned long long mul_div(unsigned long long a, unsigned long long b, unsigned long long c)
+  {
+    unsigned long long quotient  = 0;
+    unsigned long long remainder = 0;
+
+    for(int bit = 63; bit >= 0; --bit)
+    {
+      // double quotient * c + remainder
+      quotient <<= 1;
+
+      if(remainder >= c - remainder)
+      {
+        remainder -= c - remainder;
+        ++quotient;
+      }
+      else
+      {
+        remainder += remainder;
+      }
+
+      // add a
+      if((b >> bit) & 1)
+      {
+        if(remainder >= c - a)
+        {
+          remainder -= c - a;
+          ++quotient;
+        }
+        else
+        {
+          remainder += a;
+        }
+      }
+    }
+
+    return quotient;
+  }
+
+  __host__ __device__
+  Size bin(const T &x, thrust::detail::false_type) const
+  {
+    const Size result = static_cast<Size>((x - lower_level) / (upper_level - lower_level) * num_bins);
+
+    // rounding may place samples just below upper_level past the last bin
+    return result < num_bins ? result : num_bins - 1;
+  }
+};
+
+
+// maps the samples of [levels[i], levels[i + 1]) to bin i of num_bins, and
+// all other samples to num_bins. levels[0, num_bins + 1) must be sorted
+template<typename RandomAccessIterator, typename Size>
+struct range_bin
+{
+  typedef Size                                                         result_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  RandomAccessIterator levels;
+  Size num_bins;
+
+  __host__ __device__
+  range_bin(RandomAccessIterator levels, Size num_bins)
+    : levels(levels), num_bins(num_bins)
+  {}
+
+  __thrust_exec_check_disable__
+  __host__ __device__
+  Size operator()(const T &x) const
+  {
+    // count the levels which are not greater than x
+    Size lo  = 0;
+    Size len = num_bins + 1;
+
+    while(len > 0)
+    {
+      const Size half = len / 2;
+
+      if(x < levels[lo + half])
+      {
+        len = half;
+      }
+      else
+      {
+        lo  = lo + half + 1;
+        len = len - half - 1;
+      }
+    }
+
+    return (lo == 0 || lo > num_bins) ? num_bins : lo - 1;
+  }
+};
+
+
+// adds the samples of [first, last) to the counts of their bins
+__thrust_exec_check_disable__
+template<typename InputIterator,
+         typename BinFunction,
+         typename RandomAccessIterator>
+__host__ __device__
+void accumulate_bins(InputIterator first,
+                     InputIterator last,
+                     BinFunction bin,
+                     RandomAccessIterator counts)
+{
+  typedef typename BinFunction::result_type                           Size;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type counter_type;
+
+  for(; first != last; ++first)
+  {
+    const Size b = bin(*first);
+
+    if(b < bin.num_bins)
+    {
+      counts[b] = counts[b] + counter_type(1);
+    }
+  }
+}
+
+
+} // end namespace histogram_detail
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file merge_path.h
+ *  \brief Co-rank search used to partition merge-like algorithms.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/raw_reference_cast.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// returns the number of elements of [first1, first1 + n1) among the first
+// diag elements of the stable merge of [first1, first1 + n1) and
+// [first2, first2 + n2); the remaining diag - result elements come from
+// the second range. ties are resolved in favor of the first range.
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+__host__ __device__
+Size merge_path(Size diag,
+                RandomAccessIterator1 first1, Size n1,
+                RandomAccessIterator2 first2, Size n2,
+                StrictWeakOrdering comp)
+{
+  Size lo = (diag > n2) ? diag - n2 : Size(0);
+  Size hi = (diag < n1) ? diag      : n1;
+
+  while(lo < hi)
+  {
+    Size mid = lo + (hi - lo) / 2;
+
+    if(comp(thrust::raw_reference_cast(first2[diag - 1 - mid]), thrust::raw_reference_cast(first1[mid])))
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file move_down.h
+ *  \brief Moves a range to a lower, possibly overlapping, position in
+ *         parallel.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/copy.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// moves shorter than this distance are made sequentially
+const int sequential_move_cutoff = 1 << 12;
+
+
+// moves first[src, src + count) down to first[dst, dst + count), where
+// dst <= src. the range is moved in segments no longer than the distance
+// moved, none of which overlaps its destination, so each may be copied
+// in parallel
+template<typename DerivedPolicy, typename RandomAccessIterator, typename Size>
+void move_down(thrust::execution_policy<DerivedPolicy> &exec,
+               RandomAccessIterator first,
+               Size src,
+               Size dst,
+               Size count)
+{
+  const Size distance = src - dst;
+
+  if(distance == 0 || count == 0) return;
+
+  if(distance < sequential_move_cutoff)
+  {
+    for(Size i = 0; i < count; ++i)
+    {
+      first[dst + i] = first[src + i];
+    }
+
+    return;
+  }
+
+  for(Size i = 0; i < count; i += distance)
+  {
+    const Size segment = thrust::min(distance, count - i);
+
+    thrust::copy(exec, first + (src + i), first + (src + i + segment), first + (dst + i));
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,76 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file page_locking.h
+ *  \brief Helpers which keep a block of host memory resident.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/internal/first_touch.h>
+#include <cstddef>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// locks the pages of a block returned by allocate_untouched into memory so
+// that they are never paged out. this is best effort: it returns false when
+// the platform or the process's locked memory limit does not allow it.
+// blocks too small for a mapping of their own share pages with unrelated
+// allocations and are never locked
+inline bool lock_pages(void *ptr, std::size_t num_bytes)
+{
+#if defined(__linux__)
+  if(num_bytes >= 16 * page_size())
+  {
+    return ::mlock(ptr, num_bytes) == 0;
+  }
+#endif
+
+  return false;
+}
+
+
+// ptr and num_bytes must match a block passed to lock_pages
+inline void unlock_pages(void *ptr, std::size_t num_bytes)
+{
+#if defined(__linux__)
+  if(num_bytes >= 16 * page_size())
+  {
+    ::munlock(ptr, num_bytes);
+  }
+#endif
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
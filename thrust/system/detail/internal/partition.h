@@ -0,0 +1,250 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file partition.h
+ *  \brief Per-tile building blocks of the parallel partition and
+ *         stable_partition used by the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/sequential/partition.h>
+#include <thrust/detail/minmax.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace partition_detail
+{
+
+
+// partition splits its input into at most this many tiles, so that the
+// tiles' counts fit on the stack
+const int max_tiles = 256;
+
+
+// partitions first[begin, end) in place, without preserving the relative
+// order of the elements, and returns the number of elements whose stencil
+// satisfies pred. each position's stencil is tested exactly once, before
+// the element there is swapped, so the stencil may be the input itself
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename Predicate>
+Size partition_tile(RandomAccessIterator1 first,
+                    RandomAccessIterator2 stencil,
+                    Size begin,
+                    Size end,
+                    Predicate pred)
+{
+  Size lo = begin;
+  Size hi = end;
+
+  while(true)
+  {
+    while(lo < hi && pred(stencil[lo]))
+    {
+      ++lo;
+    }
+
+    while(lo < hi && !pred(stencil[hi - 1]))
+    {
+      --hi;
+    }
+
+    if(lo == hi)
+    {
+      return lo - begin;
+    }
+
+    --hi;
+
+    thrust::system::detail::sequential::iter_swap(first + lo, first + hi);
+
+    ++lo;
+  }
+}
+
+
+// once each tile of decomp has been partitioned in place, with true_counts[t]
+// true elements at its front, the false elements which lie before num_true
+// are paired in order with the true elements which lie after it. this
+// cursor visits the positions of one side of those pairs
+template<typename Decomposition, typename Size>
+class misplaced_cursor
+{
+  public:
+    misplaced_cursor(const Decomposition &decomp,
+                     const Size *true_counts,
+                     Size num_true,
+                     bool true_side,
+                     Size k)
+      : m_decomp(decomp),
+        m_true_counts(true_counts),
+        m_num_true(num_true),
+        m_true_side(true_side),
+        m_tile(0)
+    {
+      // skip the tiles which hold fewer than k of the misplaced elements
+      while(k >= end(m_tile) - begin(m_tile))
+      {
+        k -= thrust::max<Size>(0, end(m_tile) - begin(m_tile));
+        ++m_tile;
+      }
+
+      m_position = begin(m_tile) + k;
+    }
+
+    Size operator*() const
+    {
+      return m_position;
+    }
+
+    misplaced_cursor &operator++()
+    {
+      ++m_position;
+
+      while(m_position >= end(m_tile) && m_tile + 1 < m_decomp.size())
+      {
+        ++m_tile;
+        m_position = begin(m_tile);
+      }
+
+      return *this;
+    }
+
+  private:
+    // the misplaced elements of tile t lie in [begin(t), end(t))
+    Size begin(Size t) const
+    {
+      const Size middle = m_decomp[t].begin() + m_true_counts[t];
+
+      return m_true_side ? thrust::max(m_decomp[t].begin(), m_num_true) : middle;
+    }
+
+    Size end(Size t) const
+    {
+      const Size middle = m_decomp[t].begin() + m_true_counts[t];
+
+      return m_true_side ? middle : thrust::min(m_decomp[t].end(), m_num_true);
+    }
+
+    const Decomposition &m_decomp;
+    const Size *m_true_counts;
+    Size m_num_true;
+    bool m_true_side;
+    Size m_tile;
+    Size m_position;
+};
+
+
+// returns the number of false elements which lie before num_true once
+// each tile of decomp has been partitioned in place
+template<typename Decomposition, typename Size>
+Size count_misplaced(const Decomposition &decomp,
+                     const Size *true_counts,
+                     Size num_true)
+{
+  Size result = 0;
+
+  for(Size t = 0; t < decomp.size(); ++t)
+  {
+    const Size middle = decomp[t].begin() + true_counts[t];
+    const Size end    = thrust::min(decomp[t].end(), num_true);
+
+    if(middle < end)
+    {
+      result += end - middle;
+    }
+  }
+
+  return result;
+}
+
+
+// swaps the kth misplaced false element with the kth misplaced true element,
+// for each k in [k_begin, k_end)
+template<typename RandomAccessIterator, typename Decomposition, typename Size>
+void swap_misplaced(RandomAccessIterator first,
+                    const Decomposition &decomp,
+                    const Size *true_counts,
+                    Size num_true,
+                    Size k_begin,
+                    Size k_end)
+{
+  if(k_begin == k_end) return;
+
+  misplaced_cursor<Decomposition,Size> false_position(decomp, true_counts, num_true, false, k_begin);
+  misplaced_cursor<Decomposition,Size> true_position(decomp, true_counts, num_true, true, k_begin);
+
+  for(Size k = k_begin; k < k_end; ++k, ++false_position, ++true_position)
+  {
+    thrust::system::detail::sequential::iter_swap(first + *false_position, first + *true_position);
+  }
+}
+
+
+// stably moves the elements of first[begin, end) whose stencil satisfies
+// pred to the front of the tile and copies the others to false_result.
+// each stencil is tested before any element at or after it is overwritten,
+// so the stencil may be the input itself
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename OutputIterator,
+         typename Predicate>
+void stable_partition_tile(RandomAccessIterator1 first,
+                           RandomAccessIterator2 stencil,
+                           Size begin,
+                           Size end,
+                           OutputIterator false_result,
+                           Predicate pred)
+{
+  Size true_result = begin;
+
+  for(Size j = begin; j < end; ++j)
+  {
+    if(pred(stencil[j]))
+    {
+      if(true_result != j)
+      {
+        first[true_result] = first[j];
+      }
+
+      ++true_result;
+    }
+    else
+    {
+      *false_result = first[j];
+      ++false_result;
+    }
+  }
+}
+
+
+} // end namespace partition_detail
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
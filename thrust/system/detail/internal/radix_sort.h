@@ -0,0 +1,184 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file radix_sort.h
+ *  \brief Per-tile building blocks of the parallel LSD radix sorts
+ *         used by the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/functional.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace radix_sort_detail
+{
+
+
+// the parallel radix sorts examine 8 bits of the key per pass
+const unsigned int radix_bits = 8;
+const unsigned int radix_size = 1 << radix_bits;
+
+
+template<typename KeyType, typename Compare>
+struct use_radix_sort
+  : thrust::detail::and_<
+      thrust::detail::is_arithmetic<KeyType>,
+      thrust::detail::not_<
+        thrust::detail::is_same<KeyType, bool>
+      >,
+      thrust::detail::or_<
+        thrust::detail::is_same<Compare, thrust::less<KeyType> >,
+        thrust::detail::is_same<Compare, thrust::greater<KeyType> >
+      >
+    >
+{};
+
+
+template<typename KeyType, typename Compare>
+struct needs_reverse
+  : thrust::detail::integral_constant<
+      bool,
+      thrust::detail::is_same<Compare, thrust::greater<KeyType> >::value
+    >
+{};
+
+
+template<typename KeyType>
+struct radix_traits
+{
+  typedef thrust::system::detail::sequential::radix_sort_detail::RadixEncoder<KeyType> encoder_type;
+  typedef typename encoder_type::result_type                                           encoded_type;
+
+  static const unsigned int num_passes = (8 * sizeof(encoded_type) + radix_bits - 1) / radix_bits;
+};
+
+
+template<typename KeyType>
+inline unsigned int digit(const KeyType &key, unsigned int pass)
+{
+  typedef typename radix_traits<KeyType>::encoder_type encoder_type;
+  typedef typename radix_traits<KeyType>::encoded_type encoded_type;
+
+  const encoded_type x = encoder_type()(key);
+
+  return static_cast<unsigned int>((x >> (radix_bits * pass)) & (radix_size - 1));
+}
+
+
+// counts the digits of pass over keys[begin, end)
+template<typename RandomAccessIterator, typename Size>
+void histogram_tile(RandomAccessIterator keys,
+                    Size begin,
+                    Size end,
+                    unsigned int pass,
+                    size_t *histogram)
+{
+  for(unsigned int d = 0; d < radix_size; ++d)
+  {
+    histogram[d] = 0;
+  }
+
+  for(Size i = begin; i < end; ++i)
+  {
+    histogram[digit(thrust::raw_reference_cast(keys[i]), pass)]++;
+  }
+}
+
+
+// replaces the tile histograms (radix_size counts per tile, tile-major) by the
+// position at which each tile scatters its first key of each digit.
+// returns true if every key has the same digit, in which case the pass may be skipped
+template<typename Size>
+bool scan_tile_histograms(size_t *histograms, Size num_tiles, size_t n)
+{
+  size_t sum = 0;
+
+  for(unsigned int d = 0; d < radix_size; ++d)
+  {
+    size_t digit_sum = 0;
+
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      size_t count = histograms[t * radix_size + d];
+
+      histograms[t * radix_size + d] = sum;
+
+      sum       += count;
+      digit_sum += count;
+    }
+
+    if(digit_sum == n)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+// stably scatters keys[begin, end) (and their values) to their positions in
+// keys_result (and values_result), advancing the tile's scatter offsets
+template<bool HasValues,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size>
+void scatter_tile(RandomAccessIterator1 keys_first,
+                  RandomAccessIterator2 values_first,
+                  RandomAccessIterator3 keys_result,
+                  RandomAccessIterator4 values_result,
+                  Size begin,
+                  Size end,
+                  unsigned int pass,
+                  size_t *offsets)
+{
+  for(Size i = begin; i < end; ++i)
+  {
+    size_t j = offsets[digit(thrust::raw_reference_cast(keys_first[i]), pass)]++;
+
+    keys_result[j] = keys_first[i];
+
+    if(HasValues)
+    {
+      values_result[j] = values_first[i];
+    }
+  }
+}
+
+
+} // end namespace radix_sort_detail
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,338 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file selection.h
+ *  \brief Per-tile building blocks of the parallel nth_element and
+ *         partial_sort_copy used by the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/function.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/detail/sequential/partial_sort.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace selection_detail
+{
+
+
+// ranges shorter than this are selected sequentially
+const std::size_t sequential_cutoff = 1 << 15;
+
+
+// a range's order statistics are found from the histograms of its radix
+// digits when a radix sort would be used to sort it
+template<typename KeyType, typename Compare>
+struct use_radix_select
+  : thrust::system::detail::internal::radix_sort_detail::use_radix_sort<KeyType,Compare>
+{};
+
+
+// maps keys to unsigned integers which are ordered as comp orders the keys
+template<typename KeyType, typename Compare>
+struct radix_select_encoder
+{
+  typedef thrust::system::detail::internal::radix_sort_detail::radix_traits<KeyType> traits;
+
+  typedef typename traits::encoder_type encoder_type;
+  typedef typename traits::encoded_type encoded_type;
+
+  static const unsigned int num_bits   = 8 * sizeof(encoded_type);
+  static const unsigned int num_passes = traits::num_passes;
+
+  encoded_type operator()(const KeyType &key) const
+  {
+    const encoded_type x = encoder_type()(key);
+
+    return thrust::system::detail::internal::radix_sort_detail::needs_reverse<KeyType,Compare>::value ? static_cast<encoded_type>(~x) : x;
+  }
+};
+
+
+// the digit examined by pass, counting from the most significant digit
+template<typename Encoder>
+inline unsigned int msd_digit(typename Encoder::encoded_type x, unsigned int pass)
+{
+  namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+  const unsigned int shift = Encoder::num_bits - radix::radix_bits * (pass + 1);
+
+  return static_cast<unsigned int>((x >> shift) & (radix::radix_size - 1));
+}
+
+
+// counts the digits of pass over the keys of [begin, end) whose more
+// significant digits are those of prefix
+template<typename Encoder, typename RandomAccessIterator, typename Size>
+void histogram_candidates_tile(RandomAccessIterator keys,
+                               Size begin,
+                               Size end,
+                               unsigned int pass,
+                               typename Encoder::encoded_type prefix,
+                               size_t *histogram)
+{
+  namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+  typedef typename Encoder::encoded_type encoded_type;
+
+  for(unsigned int d = 0; d < radix::radix_size; ++d)
+  {
+    histogram[d] = 0;
+  }
+
+  Encoder encode;
+
+  if(pass == 0)
+  {
+    for(Size i = begin; i < end; ++i)
+    {
+      histogram[msd_digit<Encoder>(encode(thrust::raw_reference_cast(keys[i])), 0)]++;
+    }
+  }
+  else
+  {
+    const unsigned int shift = Encoder::num_bits - radix::radix_bits * pass;
+
+    for(Size i = begin; i < end; ++i)
+    {
+      const encoded_type x = encode(thrust::raw_reference_cast(keys[i]));
+
+      if((x >> shift) == (prefix >> shift))
+      {
+        histogram[msd_digit<Encoder>(x, pass)]++;
+      }
+    }
+  }
+}
+
+
+// sums the tile histograms (radix_size counts per tile, tile-major) and
+// returns the digit of the candidate of the given rank. rank becomes that
+// candidate's rank among the candidates which share its digit
+template<typename Size>
+unsigned int select_digit(const size_t *histograms, Size num_tiles, size_t &rank)
+{
+  namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+  for(unsigned int d = 0; d < radix::radix_size; ++d)
+  {
+    size_t count = 0;
+
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      count += histograms[t * radix::radix_size + d];
+    }
+
+    if(rank < count)
+    {
+      return d;
+    }
+
+    rank -= count;
+  }
+
+  // unreachable while rank is less than the number of candidates
+  return radix::radix_size - 1;
+}
+
+
+// classifies keys as ordered before (0), with (1) or after (2) a pivot whose
+// encoding is known
+template<typename Encoder>
+struct radix_classifier
+{
+  typedef typename Encoder::encoded_type encoded_type;
+
+  encoded_type pivot;
+
+  radix_classifier(encoded_type pivot)
+    : pivot(pivot)
+  {}
+
+  template<typename Reference>
+  unsigned int operator()(const Reference &key)
+  {
+    const encoded_type x = Encoder()(thrust::raw_reference_cast(key));
+
+    return x < pivot ? 0 : (x == pivot ? 1 : 2);
+  }
+};
+
+
+// classifies elements as ordered before (0), with (1) or after (2) pivot by comp
+template<typename T, typename Compare>
+struct comparison_classifier
+{
+  T pivot;
+  Compare comp;
+
+  comparison_classifier(const T &pivot, Compare comp)
+    : pivot(pivot), comp(comp)
+  {}
+
+  template<typename Reference>
+  unsigned int operator()(const Reference &x)
+  {
+    // binds x directly unless it is a proxy reference
+    const T &value = x;
+
+    return comp(value, pivot) ? 0 : (comp(pivot, value) ? 2 : 1);
+  }
+};
+
+
+// counts the elements of each class in first[begin, end)
+template<typename RandomAccessIterator, typename Size, typename Classifier>
+void count_tile(RandomAccessIterator first,
+                Size begin,
+                Size end,
+                Classifier classify,
+                size_t *counts)
+{
+  counts[0] = counts[1] = counts[2] = 0;
+
+  for(Size i = begin; i < end; ++i)
+  {
+    counts[classify(first[i])]++;
+  }
+}
+
+
+// replaces the tile counts (3 per tile, tile-major) by the position at which
+// each tile scatters its first element of each class, and returns the
+// number of elements ordered before and with the pivot
+template<typename Size>
+void scan_tile_counts(size_t *counts, Size num_tiles, size_t &num_before, size_t &num_equivalent)
+{
+  size_t sum = 0;
+
+  for(unsigned int c = 0; c < 3; ++c)
+  {
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      size_t count = counts[3 * t + c];
+
+      counts[3 * t + c] = sum;
+
+      sum += count;
+    }
+
+    if(c == 0) num_before = sum;
+    if(c == 1) num_equivalent = sum - num_before;
+  }
+}
+
+
+// scatters first[begin, end) to result, grouped by class, advancing the
+// tile's scatter offsets
+template<typename RandomAccessIterator1,
+         typename Size,
+         typename Classifier,
+         typename RandomAccessIterator2>
+void scatter_tile(RandomAccessIterator1 first,
+                  Size begin,
+                  Size end,
+                  Classifier classify,
+                  RandomAccessIterator2 result,
+                  size_t *offsets)
+{
+  for(Size i = begin; i < end; ++i)
+  {
+    result[offsets[classify(first[i])]++] = first[i];
+  }
+}
+
+
+// returns the position of a pivot for selecting the element of the given
+// rank from first[0, n): the element of proportional rank in a sorted
+// sample of the range, so that most of the range falls on the far side of it
+template<typename RandomAccessIterator, typename Size, typename Compare>
+Size sample_pivot(RandomAccessIterator first, Size n, Size rank, Compare comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  const unsigned int sample_size = 63;
+
+  Size sample[sample_size];
+
+  for(unsigned int i = 0; i < sample_size; ++i)
+  {
+    sample[i] = Size(2 * i + 1) * (n / Size(2 * sample_size));
+  }
+
+  // sort the sample's positions by their elements
+  for(unsigned int i = 1; i < sample_size; ++i)
+  {
+    Size position = sample[i];
+
+    const value_type value = first[position];
+
+    unsigned int j = i;
+
+    for(; j > 0 && comp(value, static_cast<value_type>(first[sample[j - 1]])); --j)
+    {
+      sample[j] = sample[j - 1];
+    }
+
+    sample[j] = position;
+  }
+
+  return sample[static_cast<size_t>(rank) * sample_size / static_cast<size_t>(n)];
+}
+
+
+// copies into result[0, m) a max-heap of the m elements of first[begin, end)
+// which are ordered first by comp
+template<typename RandomAccessIterator1,
+         typename Size,
+         typename RandomAccessIterator2,
+         typename Compare>
+void heap_select_tile(RandomAccessIterator1 first,
+                      Size begin,
+                      Size end,
+                      RandomAccessIterator2 result,
+                      Size m,
+                      Compare comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<
+    Compare,
+    bool
+  > wrapped_comp(comp);
+
+  thrust::system::detail::sequential::partial_sort_detail::heap_select_copy(first + begin, first + end, result, result + m, wrapped_comp);
+}
+
+
+} // end namespace selection_detail
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,161 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file set_operations.h
+ *  \brief Partitioning and serial kernels shared by parallel set operations.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/generic/scalar/binary_search.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/set_operations.h>
+#include <thrust/detail/seq.h>
+#include <thrust/pair.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// returns (i,j) such that the set operation of [first1, first1 + i) and
+// [first2, first2 + j) followed by the set operation of the remainders
+// produces the same result as the set operation of the whole ranges.
+//
+// the split begins at the merge path co-rank of diag. if that point falls
+// inside a run of equivalent elements, it is moved so that the r-th copy in
+// the first range and the r-th copy in the second range land on the same
+// side, which is how the serial algorithms pair duplicates. the result is
+// nondecreasing in diag, so consecutive diagonals yield disjoint partitions.
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+thrust::pair<Size,Size> balanced_path(Size diag,
+                                      RandomAccessIterator1 first1, Size n1,
+                                      RandomAccessIterator2 first2, Size n2,
+                                      StrictWeakOrdering comp)
+{
+  namespace scalar = thrust::system::detail::generic::scalar;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+
+  const Size i = merge_path(diag, first1, n1, first2, n2, comp);
+  const Size j = diag - i;
+
+  if(i == n1 && j == n2)
+  {
+    return thrust::make_pair(i, j);
+  }
+
+  // the next element of the merge; ties are resolved in favor of the first range
+  const value_type key = (i < n1 && (j == n2 || !comp(thrust::raw_reference_cast(first2[j]), thrust::raw_reference_cast(first1[i])))) ?
+    value_type(first1[i]) : value_type(first2[j]);
+
+  // find the run of elements equivalent to key in both ranges
+  const Size begin1 = scalar::lower_bound_n(first1,     i,      key, comp) - first1;
+  const Size end1   = scalar::upper_bound_n(first1 + i, n1 - i, key, comp) - first1;
+  const Size begin2 = scalar::lower_bound_n(first2,     j,      key, comp) - first2;
+  const Size end2   = scalar::upper_bound_n(first2 + j, n2 - j, key, comp) - first2;
+
+  const Size run1 = end1 - begin1;
+  const Size run2 = end2 - begin2;
+  const Size num_pairs = (run1 < run2) ? run1 : run2;
+
+  // the number of elements of the run which precede the split
+  const Size k = (i - begin1) + (j - begin2);
+
+  if(k <= 2 * num_pairs)
+  {
+    // split between pairs of duplicates
+    return thrust::make_pair(begin1 + k / 2, begin2 + k / 2);
+  }
+  else if(run1 > run2)
+  {
+    // split among the unpaired duplicates of the first range
+    return thrust::make_pair(begin1 + k - num_pairs, end2);
+  }
+
+  // split among the unpaired duplicates of the second range
+  return thrust::make_pair(end1, begin2 + k - num_pairs);
+}
+
+
+struct serial_set_difference
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_intersection
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_symmetric_difference
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_union
+{
+  template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
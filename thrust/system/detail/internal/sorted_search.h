@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file sorted_search.h
+ *  \brief Galloping search kernel shared by sorted_search implementations.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// writes the lower bound in [first, first + n) of each value of the sorted
+// range [values_first, values_last), searching forward from pos, which must
+// not exceed the lower bound of *values_first.
+//
+// each search gallops forward from the previous result so that runs of
+// nearby values cost O(log(distance)) rather than O(log(n)).
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename Size,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+OutputIterator galloping_sorted_search(RandomAccessIterator first,
+                                       Size n,
+                                       Size pos,
+                                       InputIterator values_first,
+                                       InputIterator values_last,
+                                       OutputIterator output,
+                                       StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  // every element of [first, first + pos) is less than the current value
+  for(; values_first != values_last; ++values_first, ++output)
+  {
+    Size step = 1;
+
+    while(pos + step <= n && wrapped_comp(first[pos + step - 1], *values_first))
+    {
+      pos += step;
+      step <<= 1;
+    }
+
+    // the lower bound lies in [pos, pos + step - 1]
+    Size len = thrust::min<Size>(step - 1, n - pos);
+
+    while(len > 0)
+    {
+      Size half = len >> 1;
+
+      if(wrapped_comp(first[pos + half], *values_first))
+      {
+        pos = pos + half + 1;
+        len = len - half - 1;
+      }
+      else
+      {
+        len = half;
+      }
+    }
+
+    *output = pos;
+  }
+
+  return output;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
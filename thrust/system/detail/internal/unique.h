@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file unique.h
+ *  \brief Per-tile building blocks of the parallel in-place unique and
+ *         unique_by_key used by the host backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace unique_detail
+{
+
+
+// returns the number of elements of keys[begin, end) which differ from
+// the element before them, counting keys[0] as such an element
+template<typename RandomAccessIterator,
+         typename Size,
+         typename BinaryPredicate>
+Size count_heads_tile(RandomAccessIterator keys,
+                      Size begin,
+                      Size end,
+                      BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  if(begin == end) return 0;
+
+  Size result = 0;
+
+  T prev = keys[begin];
+
+  if(begin == 0 || !binary_pred(keys[begin - 1], prev))
+  {
+    ++result;
+  }
+
+  for(Size j = begin + 1; j < end; ++j)
+  {
+    T temp = keys[j];
+
+    if(!binary_pred(prev, temp))
+    {
+      ++result;
+    }
+
+    prev = temp;
+  }
+
+  return result;
+}
+
+
+// moves the elements of keys[begin, end) which differ from the element
+// before them to the front of the tile, preserving their order. elements
+// are only ever written to a lower position than the one they are read
+// from, so the last element of a tile is never overwritten and the tile
+// after it may still compare its first element against it
+template<typename RandomAccessIterator,
+         typename Size,
+         typename BinaryPredicate>
+void unique_tile(RandomAccessIterator keys,
+                 Size begin,
+                 Size end,
+                 BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type T;
+
+  if(begin == end) return;
+
+  T prev = keys[begin];
+
+  Size result = (begin == 0 || !binary_pred(keys[begin - 1], prev)) ? begin + 1 : begin;
+
+  for(Size j = begin + 1; j < end; ++j)
+  {
+    T temp = keys[j];
+
+    if(!binary_pred(prev, temp))
+    {
+      if(result != j)
+      {
+        keys[result] = temp;
+      }
+
+      ++result;
+    }
+
+    prev = temp;
+  }
+}
+
+
+// as unique_tile, and moves each kept key's value along with it
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename BinaryPredicate>
+void unique_by_key_tile(RandomAccessIterator1 keys,
+                        RandomAccessIterator2 values,
+                        Size begin,
+                        Size end,
+                        BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type T;
+
+  if(begin == end) return;
+
+  T prev = keys[begin];
+
+  Size result = (begin == 0 || !binary_pred(keys[begin - 1], prev)) ? begin + 1 : begin;
+
+  for(Size j = begin + 1; j < end; ++j)
+  {
+    T temp = keys[j];
+
+    if(!binary_pred(prev, temp))
+    {
+      if(result != j)
+      {
+        keys[result]   = temp;
+        values[result] = values[j];
+      }
+
+      ++result;
+    }
+
+    prev = temp;
+  }
+}
+
+
+} // end namespace unique_detail
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -25,6 +25,7 @@
 #include <thrust/distance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/function.h>
+#include <thrust/system/detail/internal/sorted_search.h>
 
 namespace thrust
 {
@@ -150,6 +151,29 @@ bool binary_search(sequential::execution_policy<DerivedPolicy> &exec,
 }
 
 
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+OutputIterator sorted_search(sequential::execution_policy<DerivedPolicy> &,
+                             ForwardIterator first,
+                             ForwardIterator last,
+                             InputIterator values_first,
+                             InputIterator values_last,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<ForwardIterator>::type difference_type;
+
+  difference_type n = thrust::distance(first, last);
+
+  return thrust::system::detail::internal::galloping_sorted_search(first, n, difference_type(0), values_first, values_last, output, comp);
+}
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
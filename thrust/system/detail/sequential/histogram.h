@@ -0,0 +1,120 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file histogram.h
+ *  \brief Sequential implementations of histogram_even and histogram_range.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/internal/histogram.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace histogram_detail
+{
+
+
+__thrust_exec_check_disable__
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+__host__ __device__
+RandomAccessIterator count_bins(InputIterator first,
+                                InputIterator last,
+                                RandomAccessIterator histogram,
+                                BinFunction bin)
+{
+  typedef typename BinFunction::result_type                           Size;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type counter_type;
+
+  for(Size i = 0; i < bin.num_bins; ++i)
+  {
+    histogram[i] = counter_type(0);
+  }
+
+  thrust::system::detail::internal::histogram_detail::accumulate_bins(first, last, bin, histogram);
+
+  return histogram + bin.num_bins;
+}
+
+
+} // end namespace histogram_detail
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename Size,
+         typename T>
+__host__ __device__
+RandomAccessIterator histogram_even(sequential::execution_policy<DerivedPolicy> &,
+                                    InputIterator first,
+                                    InputIterator last,
+                                    RandomAccessIterator histogram,
+                                    Size num_bins,
+                                    T lower_level,
+                                    T upper_level)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  if(num_bins <= 0) return histogram;
+
+  return histogram_detail::count_bins(first, last, histogram, internal::even_bin<T,Size>(lower_level, upper_level, num_bins));
+}
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+RandomAccessIterator2 histogram_range(sequential::execution_policy<DerivedPolicy> &,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator1 levels_first,
+                                      RandomAccessIterator1 levels_last,
+                                      RandomAccessIterator2 histogram)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size num_bins = (levels_last - levels_first) - 1;
+
+  if(num_bins <= 0) return histogram;
+
+  return histogram_detail::count_bins(first, last, histogram, internal::range_bin<RandomAccessIterator1,Size>(levels_first, num_bins));
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,405 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file partial_sort.h
+ *  \brief Sequential implementations of nth_element and partial_sort.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace partial_sort_detail
+{
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator>
+__host__ __device__
+void swap_elements(RandomAccessIterator a, RandomAccessIterator b)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  value_type temp = *a;
+  *a = *b;
+  *b = temp;
+}
+
+
+// places value at first[hole] and moves it down the max-heap [first, first + len)
+// until neither of its children is ordered after it
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename Size,
+         typename T,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sift_down(RandomAccessIterator first,
+               Size hole,
+               Size len,
+               const T &value,
+               StrictWeakOrdering comp)
+{
+  Size child = 2 * hole + 1;
+
+  while(child < len)
+  {
+    // descend toward the larger child
+    if(child + 1 < len && comp(first[child], first[child + 1]))
+    {
+      ++child;
+    }
+
+    if(!comp(value, first[child]))
+    {
+      break;
+    }
+
+    first[hole] = first[child];
+
+    hole  = child;
+    child = 2 * hole + 1;
+  }
+
+  first[hole] = value;
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+__host__ __device__
+void make_heap(RandomAccessIterator first,
+               Size len,
+               StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  for(Size hole = len / 2; hole > 0; --hole)
+  {
+    value_type value = first[hole - 1];
+
+    sift_down(first, hole - 1, len, value, comp);
+  }
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename Size,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_heap(RandomAccessIterator first,
+               Size len,
+               StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  for(Size end = len - 1; end > 0; --end)
+  {
+    value_type value = first[end];
+
+    first[end] = first[0];
+
+    sift_down(first, Size(0), end, value, comp);
+  }
+}
+
+
+// rearranges [first, last) so that [first, middle) is a max-heap of the
+// middle - first elements which are ordered first
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void heap_select(RandomAccessIterator first,
+                 RandomAccessIterator middle,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size len = middle - first;
+
+  partial_sort_detail::make_heap(first, len, comp);
+
+  for(RandomAccessIterator i = middle; i < last; ++i)
+  {
+    if(comp(*i, *first))
+    {
+      value_type value = *i;
+
+      *i = *first;
+
+      sift_down(first, Size(0), len, value, comp);
+    }
+  }
+}
+
+
+// copies into [result_first, result_last) a max-heap of the elements of
+// [first, last) which are ordered first, and returns the end of the heap
+__thrust_exec_check_disable__
+template<typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator heap_select_copy(InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator result_first,
+                                      RandomAccessIterator result_last,
+                                      StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<InputIterator>::type             value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  RandomAccessIterator result = result_first;
+
+  if(result == result_last) return result;
+
+  for(; first != last && result != result_last; ++first, ++result)
+  {
+    *result = *first;
+  }
+
+  const Size len = result - result_first;
+
+  partial_sort_detail::make_heap(result_first, len, comp);
+
+  for(; first != last; ++first)
+  {
+    value_type value = *first;
+
+    if(comp(value, *result_first))
+    {
+      sift_down(result_first, Size(0), len, value, comp);
+    }
+  }
+
+  return result;
+}
+
+
+// moves the median of *a, *b and *c to *result
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void move_median_to_first(RandomAccessIterator result,
+                          RandomAccessIterator a,
+                          RandomAccessIterator b,
+                          RandomAccessIterator c,
+                          StrictWeakOrdering comp)
+{
+  if(comp(*a, *b))
+  {
+    if(comp(*b, *c))      swap_elements(result, b);
+    else if(comp(*a, *c)) swap_elements(result, c);
+    else                  swap_elements(result, a);
+  }
+  else if(comp(*a, *c))   swap_elements(result, a);
+  else if(comp(*b, *c))   swap_elements(result, c);
+  else                    swap_elements(result, b);
+}
+
+
+// partitions [first, last) about *pivot, which lies outside of the range.
+// the median of three selection guarantees that neither scan runs off the range
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator unguarded_partition(RandomAccessIterator first,
+                                         RandomAccessIterator last,
+                                         RandomAccessIterator pivot,
+                                         StrictWeakOrdering comp)
+{
+  while(true)
+  {
+    while(comp(*first, *pivot))
+    {
+      ++first;
+    }
+
+    --last;
+
+    while(comp(*pivot, *last))
+    {
+      --last;
+    }
+
+    if(!(first < last))
+    {
+      return first;
+    }
+
+    swap_elements(first, last);
+
+    ++first;
+  }
+}
+
+
+// quickselect which falls back to heap_select when partitioning degenerates
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void introselect(RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  // allow 2 * log2(n) partitioning rounds
+  Size depth_limit = 0;
+  for(Size n = last - first; n > 1; n /= 2)
+  {
+    depth_limit += 2;
+  }
+
+  while(last - first > 16)
+  {
+    if(depth_limit == 0)
+    {
+      heap_select(first, nth + 1, last, comp);
+
+      // the root of the heap is the largest of the nth + 1 smallest elements
+      swap_elements(first, nth);
+
+      return;
+    }
+
+    --depth_limit;
+
+    RandomAccessIterator mid = first + (last - first) / 2;
+
+    move_median_to_first(first, first + 1, mid, last - 1, comp);
+
+    RandomAccessIterator cut = unguarded_partition(first + 1, last, first, comp);
+
+    if(cut <= nth)
+    {
+      first = cut;
+    }
+    else
+    {
+      last = cut;
+    }
+  }
+
+  sequential::insertion_sort(first, last, comp);
+}
+
+
+} // end namespace partial_sort_detail
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void nth_element(sequential::execution_policy<DerivedPolicy> &,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  if(nth == last) return;
+
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  partial_sort_detail::introselect(first, nth, last, wrapped_comp);
+}
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void partial_sort(sequential::execution_policy<DerivedPolicy> &,
+                  RandomAccessIterator first,
+                  RandomAccessIterator middle,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp)
+{
+  if(first == middle) return;
+
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  partial_sort_detail::heap_select(first, middle, last, wrapped_comp);
+  partial_sort_detail::sort_heap(first, middle - first, wrapped_comp);
+}
+
+
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator partial_sort_copy(sequential::execution_policy<DerivedPolicy> &,
+                                       InputIterator first,
+                                       InputIterator last,
+                                       RandomAccessIterator result_first,
+                                       RandomAccessIterator result_last,
+                                       StrictWeakOrdering comp)
+{
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  RandomAccessIterator result = partial_sort_detail::heap_select_copy(first, last, result_first, result_last, wrapped_comp);
+
+  partial_sort_detail::sort_heap(result_first, result - result_first, wrapped_comp);
+
+  return result;
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+} // end namespace thrust
+
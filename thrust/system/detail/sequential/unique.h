@@ -90,6 +90,45 @@ __host__ __device__
 } // end unique()
 
 
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+__host__ __device__
+  typename thrust::iterator_difference<ForwardIterator>::type
+    unique_count(sequential::execution_policy<DerivedPolicy> &,
+                 ForwardIterator first,
+                 ForwardIterator last,
+                 BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_traits<ForwardIterator>::value_type T;
+
+  typename thrust::iterator_difference<ForwardIterator>::type result = 0;
+
+  if(first != last)
+  {
+    T prev = *first;
+
+    ++result;
+
+    for(++first; first != last; ++first)
+    {
+      T temp = *first;
+
+      // compare against the kept element, as unique_copy does
+      if(!binary_pred(prev, temp))
+      {
+        ++result;
+
+        prev = temp;
+      }
+    }
+  }
+
+  return result;
+} // end unique_count()
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -19,6 +19,13 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/generic/scalar/binary_search.h>
+#include <thrust/system/detail/internal/sorted_search.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/distance.h>
 
 namespace thrust
 {
@@ -66,6 +73,56 @@ bool binary_search(execution_policy<DerivedPolicy> &exec,
 }
 
 
+template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator sorted_search(execution_policy<DerivedPolicy> &,
+                             ForwardIterator first,
+                             ForwardIterator last,
+                             InputIterator values_first,
+                             InputIterator values_last,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<ForwardIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename thrust::iterator_difference<ForwardIterator>::type Size;
+
+  const Size n          = thrust::distance(first, last);
+  const Size num_values = thrust::distance(values_first, values_last);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // give each thread a contiguous interval of values; each interval locates
+  // its first value from scratch and gallops through the rest
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(num_values);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    Size begin = decomp[i].begin();
+    Size end   = decomp[i].end();
+
+    Size pos = thrust::system::detail::generic::scalar::lower_bound_n(first, n, values_first[begin], comp) - first;
+
+    thrust::system::detail::internal::galloping_sorted_search(first, n, pos,
+                                                              values_first + begin, values_first + end,
+                                                              output + begin,
+                                                              comp);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return output + num_values;
+}
+
+
 } // end detail
 } // end omp
 } // end system
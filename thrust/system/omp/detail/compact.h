@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file compact.h
+ *  \brief OpenMP stream compaction shared by copy_if and stable_partition_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/pair.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// copies the elements of [first, last) whose stencil satisfies pred to
+// out_true and the others to out_false, preserving their relative order.
+// each interval is counted, the counts are scanned, and each interval is
+// then copied directly to its place, so only one counter per interval of
+// temporary storage is needed
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Predicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    compact(execution_policy<DerivedPolicy> &exec,
+            InputIterator1 first,
+            InputIterator1 last,
+            InputIterator2 stencil,
+            OutputIterator1 out_true,
+            OutputIterator2 out_false,
+            Predicate pred);
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
+#include <thrust/system/omp/detail/compact.inl>
+
@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/compact.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/function.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/detail/cstdint.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Predicate>
+  thrust::pair<OutputIterator1,OutputIterator2>
+    compact(execution_policy<DerivedPolicy> &exec,
+            InputIterator1 first,
+            InputIterator1 last,
+            InputIterator2 stencil,
+            OutputIterator1 out_true,
+            OutputIterator2 out_false,
+            Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  const Size n = thrust::distance(first, last);
+
+  if(n == 0)
+    return thrust::make_pair(out_true, out_false);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  // one counter per interval is the only temporary storage
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_intervals + 1);
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+# pragma omp parallel
+  {
+    // count the true elements of each interval
+#   pragma omp for schedule(static)
+    for(index_type i = 0; i < num_intervals; i++)
+    {
+      Size count = 0;
+
+      for(Size j = decomp[i].begin(); j < decomp[i].end(); ++j)
+      {
+        if(wrapped_pred(stencil[j]))
+        {
+          ++count;
+        }
+      }
+
+      offsets[i + 1] = count;
+    }
+
+    // scan the (few) counts serially
+#   pragma omp single
+    {
+      offsets[0] = 0;
+
+      for(index_type i = 0; i < num_intervals; i++)
+      {
+        offsets[i + 1] += offsets[i];
+      }
+    }
+
+    // copy each interval directly to its place in both outputs;
+    // the static schedule gives each thread the intervals it just counted
+#   pragma omp for schedule(static)
+    for(index_type i = 0; i < num_intervals; i++)
+    {
+      OutputIterator1 true_result  = out_true  + offsets[i];
+      OutputIterator2 false_result = out_false + (decomp[i].begin() - offsets[i]);
+
+      for(Size j = decomp[i].begin(); j < decomp[i].end(); ++j)
+      {
+        if(wrapped_pred(stencil[j]))
+        {
+          *true_result = first[j];
+          ++true_result;
+        }
+        else
+        {
+          *false_result = first[j];
+          ++false_result;
+        }
+      }
+    }
+  }
+
+  thrust::advance(out_true,  offsets[num_intervals]);
+  thrust::advance(out_false, n - offsets[num_intervals]);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(out_true, out_false);
+} // end compact()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
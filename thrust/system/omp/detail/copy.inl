@@ -20,7 +20,13 @@
 #include <thrust/system/omp/detail/copy.h>
 #include <thrust/system/detail/generic/copy.h>
 #include <thrust/system/detail/sequential/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/detail/dispatch/is_trivial_copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <cstddef>
 
 
 namespace thrust
@@ -31,6 +37,87 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+// copies smaller than this are not worth starting a parallel region for
+const std::size_t parallel_trivial_copy_threshold_bytes = 1 << 16;
+
+
+// copies plain old data with one memmove per thread
+template<typename T>
+  T *trivial_copy_n(const T *first, std::ptrdiff_t n, T *result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<T,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  // overlapping ranges must be moved as a whole
+  if(n * sizeof(T) < parallel_trivial_copy_threshold_bytes || (result < first + n && first < result + n))
+  {
+    return thrust::system::detail::sequential::trivial_copy_n(first, n, result);
+  } // end if
+
+// do not attempt to compile the body of this function, which depends on #pragma omp,
+// without support from the compiler
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef std::ptrdiff_t index_type;
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp = default_decomposition<index_type>(n);
+
+  index_type num_intervals = decomp.size();
+
+#pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::index_range<index_type> range = decomp[i];
+
+    thrust::system::detail::sequential::trivial_copy_n(first + range.begin(), range.size(), result + range.begin());
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+} // end trivial_copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::true_type) // is_trivial_copy
+{
+  copy_detail::trivial_copy_n(thrust::raw_pointer_cast(&*first), n, thrust::raw_pointer_cast(&*result));
+
+  return result + n;
+} // end copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::false_type) // is_trivial_copy
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -57,7 +144,8 @@ template<typename DerivedPolicy,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return thrust::system::omp::detail::copy_detail::copy_n(exec, first, last - first, result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
 } // end copy()
 
 
@@ -85,7 +173,8 @@ template<typename DerivedPolicy,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return thrust::system::omp::detail::copy_detail::copy_n(exec, first, n, result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
 } // end copy_n()
 
 
@@ -18,7 +18,8 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/copy_if.h>
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/system/omp/detail/compact.h>
+#include <thrust/iterator/discard_iterator.h>
 
 namespace thrust
 {
@@ -42,8 +43,8 @@ template<typename DerivedPolicy,
                          OutputIterator result,
                          Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  // copy_if is a compaction with the false partition discarded
+  return thrust::system::omp::detail::compact(exec, first, last, stencil, result, thrust::make_discard_iterator(), pred).first;
 } // end copy_if()
 
 
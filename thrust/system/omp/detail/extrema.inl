@@ -0,0 +1,219 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/extrema.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/detail/internal/extrema.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace extrema_detail
+{
+
+
+// finds the extrema of data[0, n), n > 0, with one pass over each thread's tile
+template<bool FindMin, bool FindMax, typename DerivedPolicy, typename T, typename Size>
+thrust::system::detail::internal::extrema_detail::extrema<T,Size>
+  fused_extrema(execution_policy<DerivedPolicy> &exec,
+                const T *data,
+                Size n)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<T,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  namespace internal = thrust::system::detail::internal::extrema_detail;
+
+  typedef internal::extrema<T,Size> extrema_type;
+
+  // a single block is not worth starting a parallel region for
+  if(n <= internal::block_size)
+  {
+    return internal::tile_extrema<FindMin,FindMax>(data, Size(0), n);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = default_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<extrema_type, DerivedPolicy> tiles_storage(exec, num_tiles);
+  extrema_type *tiles = thrust::raw_pointer_cast(&*tiles_storage.begin());
+
+// do not attempt to compile the body of this function, which depends on #pragma omp,
+// without support from the compiler
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+# pragma omp parallel for schedule(static)
+  for(Size i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::index_range<Size> range = decomp[i];
+
+    tiles[i] = internal::tile_extrema<FindMin,FindMax>(data, range.begin(), range.end());
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  // merge the tiles in order, so that the first occurrence wins ties
+  extrema_type result = tiles[0];
+
+  for(Size i = 1; i < num_tiles; ++i)
+  {
+    internal::merge_extrema<FindMin,FindMax>(result, tiles[i]);
+  }
+
+  return result;
+} // end fused_extrema()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate,
+                            thrust::detail::true_type) // use_fused_extrema
+{
+  if(first == last) return last;
+
+  return first + fused_extrema<false,true>(exec, thrust::raw_pointer_cast(&*first), last - first).max_index;
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::false_type) // use_fused_extrema
+{
+  // omp prefers generic::max_element to cpp::max_element
+  return thrust::system::detail::generic::max_element(exec, first, last, comp);
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate,
+                            thrust::detail::true_type) // use_fused_extrema
+{
+  if(first == last) return last;
+
+  return first + fused_extrema<true,false>(exec, thrust::raw_pointer_cast(&*first), last - first).min_index;
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::false_type) // use_fused_extrema
+{
+  // omp prefers generic::min_element to cpp::min_element
+  return thrust::system::detail::generic::min_element(exec, first, last, comp);
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first, 
+                                                             ForwardIterator last,
+                                                             BinaryPredicate,
+                                                             thrust::detail::true_type) // use_fused_extrema
+{
+  if(first == last) return thrust::make_pair(last, last);
+
+  thrust::system::detail::internal::extrema_detail::extrema<
+    typename thrust::iterator_value<ForwardIterator>::type,
+    typename thrust::iterator_difference<ForwardIterator>::type
+  > result = fused_extrema<true,true>(exec, thrust::raw_pointer_cast(&*first), last - first);
+
+  return thrust::make_pair(first + result.min_index, first + result.max_index);
+} // end minmax_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first, 
+                                                             ForwardIterator last,
+                                                             BinaryPredicate comp,
+                                                             thrust::detail::false_type) // use_fused_extrema
+{
+  // omp prefers generic::minmax_element to cpp::minmax_element
+  return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+} // end minmax_element()
+
+
+} // end extrema_detail
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp)
+{
+  return extrema_detail::max_element(exec, first, last, comp,
+    typename thrust::system::detail::internal::extrema_detail::use_fused_extrema<ForwardIterator,BinaryPredicate>::type());
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp)
+{
+  return extrema_detail::min_element(exec, first, last, comp,
+    typename thrust::system::detail::internal::extrema_detail::use_fused_extrema<ForwardIterator,BinaryPredicate>::type());
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first, 
+                                                             ForwardIterator last,
+                                                             BinaryPredicate comp)
+{
+  return extrema_detail::minmax_element(exec, first, last, comp,
+    typename thrust::system::detail::internal::extrema_detail::use_fused_extrema<ForwardIterator,BinaryPredicate>::type());
+} // end minmax_element()
+
+
+} // end detail
+} // end omp
+} // end system
+} // end thrust
+
@@ -0,0 +1,181 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/histogram.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/sequential/histogram.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/minmax.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+RandomAccessIterator privatized_histogram(execution_policy<DerivedPolicy> &,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          RandomAccessIterator histogram,
+                                          BinFunction bin,
+                                          thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::sequential::histogram_detail::count_bins(first, last, histogram, bin);
+}
+
+
+// every tile counts its samples into bins of its own, and the tiles' bins
+// are summed into the histogram
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+RandomAccessIterator privatized_histogram(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          RandomAccessIterator histogram,
+                                          BinFunction bin,
+                                          thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename BinFunction::result_type                           Size;
+  typedef typename thrust::iterator_difference<InputIterator>::type   Difference;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type counter_type;
+
+  const Difference n = last - first;
+  const Size num_bins = bin.num_bins;
+
+  // every tile counts at least num_bins samples, so that the tiles' bins
+  // take no more storage than the samples
+  const Difference max_tiles = thrust::max<Difference>(1, thrust::system::omp::detail::default_decomposition(n).size());
+
+  thrust::system::detail::internal::uniform_decomposition<Difference> decomp(n, static_cast<Difference>(num_bins), max_tiles);
+
+  const Difference num_tiles = decomp.size();
+
+  if(num_tiles <= 1)
+  {
+    return thrust::system::detail::sequential::histogram_detail::count_bins(first, last, histogram, bin);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::detail::temporary_array<counter_type,DerivedPolicy> counts_storage(exec, num_tiles * num_bins);
+  counter_type *counts = thrust::raw_pointer_cast(&*counts_storage.begin());
+
+# pragma omp parallel for
+  for(Difference t = 0; t < num_tiles; ++t)
+  {
+    thrust::system::detail::sequential::histogram_detail::count_bins(first + decomp[t].begin(), first + decomp[t].end(), counts + t * num_bins, bin);
+  }
+
+# pragma omp parallel for
+  for(Size b = 0; b < num_bins; ++b)
+  {
+    counter_type sum = counts[b];
+
+    for(Difference t = 1; t < num_tiles; ++t)
+    {
+      sum += counts[t * num_bins + b];
+    }
+
+    histogram[b] = sum;
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return histogram + num_bins;
+}
+
+
+} // end namespace histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename Size,
+         typename T>
+RandomAccessIterator histogram_even(execution_policy<DerivedPolicy> &exec,
+                                    InputIterator first,
+                                    InputIterator last,
+                                    RandomAccessIterator histogram,
+                                    Size num_bins,
+                                    T lower_level,
+                                    T upper_level)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  if(num_bins <= 0) return histogram;
+
+  typedef typename thrust::iterator_traversal<InputIterator>::type traversal;
+
+  return histogram_detail::privatized_histogram(exec, first, last, histogram, internal::even_bin<T,Size>(lower_level, upper_level, num_bins), traversal());
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+RandomAccessIterator2 histogram_range(execution_policy<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator1 levels_first,
+                                      RandomAccessIterator1 levels_last,
+                                      RandomAccessIterator2 histogram)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size num_bins = (levels_last - levels_first) - 1;
+
+  if(num_bins <= 0) return histogram;
+
+  typedef typename thrust::iterator_traversal<InputIterator>::type traversal;
+
+  return histogram_detail::privatized_histogram(exec, first, last, histogram, internal::range_bin<RandomAccessIterator1,Size>(levels_first, num_bins), traversal());
+}
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
@@ -18,7 +18,11 @@
 #include <thrust/system/cpp/detail/execution_policy.h>
 #include <thrust/system/omp/memory.h>
 #include <thrust/system/cpp/memory.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/first_touch.h>
+#include <thrust/detail/static_assert.h>
 #include <limits>
+#include <new>
 
 namespace thrust
 {
@@ -104,6 +108,64 @@ inline void free(pointer<void> ptr)
   detail::free_workaround(cpp::tag(), ptr);
 } // end free()
 
+
+template<typename T>
+  typename numa_allocator<T>::pointer
+    numa_allocator<T>
+      ::allocate(size_type cnt)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<T,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  if(cnt > this->max_size())
+  {
+    throw std::bad_alloc();
+  } // end if
+
+  char *result = static_cast<char*>(thrust::system::detail::internal::allocate_untouched(cnt * sizeof(T)));
+
+  if(result == 0 && cnt > 0)
+  {
+    throw std::bad_alloc();
+  } // end if
+
+// do not attempt to compile the body of this function, which depends on #pragma omp,
+// without support from the compiler
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef std::ptrdiff_t index_type;
+
+  // touch each interval's pages from the thread which processes the same
+  // interval of a statically scheduled loop
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp = detail::default_decomposition<index_type>(cnt);
+
+  index_type num_intervals = decomp.size();
+
+#pragma omp parallel for schedule(static, 1)
+  for(index_type i = 0; i < num_intervals; ++i)
+  {
+    thrust::system::detail::internal::index_range<index_type> range = decomp[i];
+
+    thrust::system::detail::internal::touch_pages(result + range.begin() * sizeof(T),
+                                                  result + range.end()   * sizeof(T));
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return pointer(reinterpret_cast<T*>(result));
+} // end numa_allocator::allocate()
+
+
+template<typename T>
+  void numa_allocator<T>
+    ::deallocate(pointer p, size_type cnt)
+{
+  thrust::system::detail::internal::deallocate_untouched(thrust::raw_pointer_cast(p), cnt * sizeof(T));
+} // end numa_allocator::deallocate()
+
 } // end omp
 } // end system
 } // end thrust
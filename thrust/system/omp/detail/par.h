@@ -30,10 +30,30 @@ namespace detail
 {
 
 
+// an execution policy which selects the memory-frugal variants of algorithms
+// which otherwise allocate temporary storage as large as their input
+// see sort.inl for how the scratch fraction is interpreted
+struct execute_with_bounded_memory : thrust::system::omp::detail::execution_policy<execute_with_bounded_memory>
+{
+  double m_scratch_fraction;
+
+  explicit execute_with_bounded_memory(double scratch_fraction)
+    : thrust::system::omp::detail::execution_policy<execute_with_bounded_memory>(),
+      m_scratch_fraction(scratch_fraction)
+  {}
+};
+
+
 struct par_t : thrust::system::omp::detail::execution_policy<par_t>
 {
   par_t() : thrust::system::omp::detail::execution_policy<par_t>() {}
 
+  // sort with at most scratch_fraction * n elements of temporary storage
+  execute_with_bounded_memory bounded_memory(double scratch_fraction = 1.0 / 16) const
+  {
+    return execute_with_bounded_memory(scratch_fraction);
+  }
+
   template<typename Allocator>
     thrust::detail::execute_with_allocator<Allocator, thrust::system::omp::detail::execution_policy>
       operator()(Allocator &alloc) const
@@ -0,0 +1,356 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/partial_sort.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/generic/partial_sort.h>
+#include <thrust/system/detail/sequential/partial_sort.h>
+#include <thrust/system/detail/internal/selection.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/pair.h>
+#include <thrust/copy.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace partial_sort_detail
+{
+
+
+// rearranges first[0, n) into the elements which classify places before,
+// with and after its pivot, using temp[0, n) as scratch space.
+// returns the number of elements before and with the pivot
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename Size,
+         typename Classifier,
+         typename RandomAccessIterator2>
+thrust::pair<Size,Size> partition_about_pivot(execution_policy<DerivedPolicy> &exec,
+                                              RandomAccessIterator1 first,
+                                              Size n,
+                                              Classifier classify,
+                                              RandomAccessIterator2 temp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  size_t num_before = 0;
+  size_t num_equivalent = n;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<size_t,DerivedPolicy> counts_storage(exec, 3 * num_tiles);
+  size_t *counts = thrust::raw_pointer_cast(&*counts_storage.begin());
+
+# pragma omp parallel for
+  for(Size t = 0; t < num_tiles; ++t)
+  {
+    selection::count_tile(first, decomp[t].begin(), decomp[t].end(), classify, counts + 3 * t);
+  }
+
+  selection::scan_tile_counts(counts, num_tiles, num_before, num_equivalent);
+
+# pragma omp parallel for
+  for(Size t = 0; t < num_tiles; ++t)
+  {
+    selection::scatter_tile(first, decomp[t].begin(), decomp[t].end(), classify, temp, counts + 3 * t);
+  }
+
+  thrust::copy(exec, temp, temp + n, first);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(Size(num_before), Size(num_equivalent));
+}
+
+
+// radix select: finds the encoding of the nth key one digit at a time from
+// the histograms of the keys which agree with it so far, then partitions
+// about it once
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering,
+                 thrust::detail::true_type) // use_radix_select
+{
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  namespace radix     = thrust::system::detail::internal::radix_sort_detail;
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  typedef selection::radix_select_encoder<KeyType,StrictWeakOrdering> Encoder;
+  typedef typename Encoder::encoded_type                              encoded_type;
+
+  const Size n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  // one histogram per tile, reused by every pass
+  thrust::detail::temporary_array<size_t,DerivedPolicy> histograms_storage(exec, num_tiles * radix::radix_size);
+  size_t *histograms = thrust::raw_pointer_cast(&*histograms_storage.begin());
+
+  size_t rank = nth - first;
+  encoded_type pivot = 0;
+
+  for(unsigned int pass = 0; pass < Encoder::num_passes; ++pass)
+  {
+#   pragma omp parallel for
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      selection::histogram_candidates_tile<Encoder>(first, decomp[t].begin(), decomp[t].end(), pass, pivot, histograms + t * radix::radix_size);
+    }
+
+    const unsigned int d = selection::select_digit(histograms, num_tiles, rank);
+
+    pivot |= static_cast<encoded_type>(d) << (Encoder::num_bits - radix::radix_bits * (pass + 1));
+  }
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> temp(exec, n);
+
+  partition_about_pivot(exec, first, n, selection::radix_classifier<Encoder>(pivot), temp.begin());
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+// sample select: partitions about a sampled pivot and keeps the side which
+// holds nth until it is short enough to finish sequentially
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type) // use_radix_select
+{
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  thrust::detail::temporary_array<value_type,DerivedPolicy> temp(exec, last - first);
+
+  const Size rank = nth - first;
+
+  Size lo = 0;
+  Size hi = last - first;
+
+  while(static_cast<size_t>(hi - lo) >= selection::sequential_cutoff)
+  {
+    const Size n = hi - lo;
+
+    value_type pivot = first[lo + selection::sample_pivot(first + lo, n, rank - lo, comp)];
+
+    thrust::pair<Size,Size> counts =
+      partition_about_pivot(exec, first + lo, n, selection::comparison_classifier<value_type,StrictWeakOrdering>(pivot, comp), temp.begin());
+
+    const Size before = lo + counts.first;
+    const Size after  = before + counts.second;
+
+    if(rank < before)
+    {
+      hi = before;
+    }
+    else if(rank < after)
+    {
+      // nth is equivalent to the pivot
+      return;
+    }
+    else
+    {
+      lo = after;
+    }
+  }
+
+  thrust::system::detail::sequential::nth_element(exec, first + lo, nth, first + hi, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator first,
+                                       InputIterator last,
+                                       RandomAccessIterator result_first,
+                                       RandomAccessIterator result_last,
+                                       StrictWeakOrdering comp,
+                                       thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator first,
+                                       InputIterator last,
+                                       RandomAccessIterator result_first,
+                                       RandomAccessIterator result_last,
+                                       StrictWeakOrdering comp,
+                                       thrust::random_access_traversal_tag)
+{
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size n = last - first;
+  const Size m = thrust::min<Size>(n, result_last - result_first);
+
+  if(static_cast<size_t>(n) < selection::sequential_cutoff)
+  {
+    return thrust::system::detail::sequential::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  // unless m is small relative to a tile, select from a copy of the input
+  if(m == 0 || 8 * m > n / num_tiles)
+  {
+    return thrust::system::detail::generic::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // every tile keeps a heap of its m first elements in a single pass, and
+  // the result is selected from the union of the heaps
+  thrust::detail::temporary_array<value_type,DerivedPolicy> candidates(exec, num_tiles * m);
+
+  // the heaps compare elements in place, so address them through raw pointers
+  value_type *candidates_ptr = thrust::raw_pointer_cast(&*candidates.begin());
+
+# pragma omp parallel for
+  for(Size t = 0; t < num_tiles; ++t)
+  {
+    selection::heap_select_tile(first, decomp[t].begin(), decomp[t].end(), candidates_ptr + t * m, m, comp);
+  }
+
+  return thrust::system::detail::sequential::partial_sort_copy(exec, candidates_ptr, candidates_ptr + num_tiles * m, result_first, result_last, comp);
+#else
+  return result_first;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end namespace partial_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  if(nth == last) return;
+
+  if(static_cast<size_t>(last - first) < selection::sequential_cutoff)
+  {
+    thrust::system::detail::sequential::nth_element(exec, first, nth, last, comp);
+    return;
+  }
+
+  typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
+  selection::use_radix_select<KeyType,StrictWeakOrdering> use_radix_select;
+
+  partial_sort_detail::nth_element(exec, first, nth, last, comp, use_radix_select);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void partial_sort(execution_policy<DerivedPolicy> &exec,
+                  RandomAccessIterator first,
+                  RandomAccessIterator middle,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp)
+{
+  // omp prefers generic::partial_sort to cpp::partial_sort
+  thrust::system::detail::generic::partial_sort(exec, first, middle, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator first,
+                                       InputIterator last,
+                                       RandomAccessIterator result_first,
+                                       RandomAccessIterator result_last,
+                                       StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_traversal<InputIterator>::type traversal;
+
+  return partial_sort_detail::partial_sort_copy(exec, first, last, result_first, result_last, comp, traversal());
+}
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
@@ -15,8 +15,8 @@
  */
 
 
-/*! \file reduce.h
- *  \brief OpenMP implementation of reduce algorithms.
+/*! \file partition.h
+ *  \brief OpenMP implementation of partition algorithms.
  */
 
 #pragma once
@@ -35,6 +35,24 @@ namespace detail
 {
 
 
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            Predicate pred);
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            InputIterator stencil,
+                            Predicate pred);
+
 template<typename DerivedPolicy,
          typename ForwardIterator,
          typename Predicate>
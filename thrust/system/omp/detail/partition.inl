@@ -15,15 +15,23 @@
  */
 
 
-/*! \file reduce.h
- *  \brief OpenMP implementation of reduce algorithms.
- */
-
 #pragma once
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/partition.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/omp/detail/compact.h>
+#include <thrust/system/detail/internal/partition.h>
+#include <thrust/system/detail/internal/move_down.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/copy.h>
 
 namespace thrust
 {
@@ -33,6 +41,255 @@ namespace omp
 {
 namespace detail
 {
+namespace partition_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            InputIterator stencil,
+                            Predicate pred,
+                            thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::partition(exec, first, last, stencil, pred);
+} // end partition()
+
+
+// each tile is partitioned in place, and the false elements left before the
+// partition point are then swapped with the true elements left after it.
+// neither step needs temporary storage
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Predicate>
+  RandomAccessIterator1 partition(execution_policy<DerivedPolicy> &,
+                                  RandomAccessIterator1 first,
+                                  RandomAccessIterator1 last,
+                                  RandomAccessIterator2 stencil,
+                                  Predicate pred,
+                                  thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  namespace internal = thrust::system::detail::internal::partition_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = last - first;
+
+  if(n == 0) return first;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+
+  Decomposition decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(decomp.size() > internal::max_tiles)
+  {
+    decomp = Decomposition(n, 1, internal::max_tiles);
+  }
+
+  typedef thrust::detail::intptr_t index_type;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  Size true_counts[internal::max_tiles];
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+# pragma omp parallel for schedule(static)
+  for(index_type i = 0; i < num_tiles; i++)
+  {
+    true_counts[i] = internal::partition_tile(first, stencil, decomp[i].begin(), decomp[i].end(), wrapped_pred);
+  }
+
+  Size num_true = 0;
+
+  for(index_type i = 0; i < num_tiles; i++)
+  {
+    num_true += true_counts[i];
+  }
+
+  const Size num_misplaced = internal::count_misplaced(decomp, true_counts, num_true);
+
+  Decomposition swaps = thrust::system::omp::detail::default_decomposition(num_misplaced);
+
+  const index_type num_swap_tiles = static_cast<index_type>(swaps.size());
+
+# pragma omp parallel for schedule(static)
+  for(index_type i = 0; i < num_swap_tiles; i++)
+  {
+    internal::swap_misplaced(first, decomp, true_counts, num_true, swaps[i].begin(), swaps[i].end());
+  }
+
+  return first + num_true;
+#else
+  return first;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end partition()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator stable_partition(execution_policy<DerivedPolicy> &exec,
+                                   ForwardIterator first,
+                                   ForwardIterator last,
+                                   InputIterator stencil,
+                                   Predicate pred,
+                                   thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+} // end stable_partition()
+
+
+// each tile's true elements are counted, and each tile then moves its true
+// elements to its front and copies its false elements directly to their
+// place in a buffer holding only the false elements. the tiles' true
+// elements are finally moved down, in order, and followed by the buffer
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Predicate>
+  RandomAccessIterator1 stable_partition(execution_policy<DerivedPolicy> &exec,
+                                         RandomAccessIterator1 first,
+                                         RandomAccessIterator1 last,
+                                         RandomAccessIterator2 stencil,
+                                         Predicate pred,
+                                         thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  namespace internal = thrust::system::detail::internal::partition_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      value_type;
+
+  const Size n = last - first;
+
+  if(n == 0) return first;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_tiles + 1);
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  // count the true elements of each tile
+# pragma omp parallel for schedule(static)
+  for(index_type i = 0; i < num_tiles; i++)
+  {
+    Size count = 0;
+
+    for(Size j = decomp[i].begin(); j < decomp[i].end(); ++j)
+    {
+      if(wrapped_pred(stencil[j]))
+      {
+        ++count;
+      }
+    }
+
+    offsets[i + 1] = count;
+  }
+
+  offsets[0] = 0;
+
+  for(index_type i = 0; i < num_tiles; i++)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+
+  const Size num_true = offsets[num_tiles];
+
+  // nothing moves unless there are elements of both kinds
+  if(num_true == 0 || num_true == n)
+  {
+    return first + num_true;
+  }
+
+  thrust::detail::temporary_array<value_type,DerivedPolicy> falses_storage(exec, n - num_true);
+  value_type *falses = thrust::raw_pointer_cast(&*falses_storage.begin());
+
+# pragma omp parallel for schedule(static)
+  for(index_type i = 0; i < num_tiles; i++)
+  {
+    internal::stable_partition_tile(first, stencil, decomp[i].begin(), decomp[i].end(), falses + (decomp[i].begin() - offsets[i]), wrapped_pred);
+  }
+
+  // the destination of each tile's true elements lies below those of the
+  // tiles after it, so moving the tiles in order overwrites none unmoved
+  for(index_type i = 1; i < num_tiles; i++)
+  {
+    thrust::system::detail::internal::move_down(exec, first, decomp[i].begin(), offsets[i], offsets[i + 1] - offsets[i]);
+  }
+
+  thrust::copy(exec, falses, falses + (n - num_true), first + num_true);
+
+  return first + num_true;
+#else
+  return first;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end stable_partition()
+
+
+} // end partition_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            Predicate pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return thrust::system::omp::detail::partition_detail::partition(exec, first, last, first, pred, traversal());
+} // end partition()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            InputIterator stencil,
+                            Predicate pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal1;
+  typedef typename thrust::iterator_traversal<InputIterator>::type   traversal2;
+
+  typedef typename thrust::detail::minimum_type<traversal1,traversal2>::type traversal;
+
+  return thrust::system::omp::detail::partition_detail::partition(exec, first, last, stencil, pred, traversal());
+} // end partition()
 
 
 template<typename DerivedPolicy,
@@ -43,8 +300,9 @@ template<typename DerivedPolicy,
                                    ForwardIterator last,
                                    Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return thrust::system::omp::detail::partition_detail::stable_partition(exec, first, last, first, pred, traversal());
 } // end stable_partition()
 
 
@@ -58,8 +316,12 @@ template<typename DerivedPolicy,
                                    InputIterator stencil,
                                    Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal1;
+  typedef typename thrust::iterator_traversal<InputIterator>::type   traversal2;
+
+  typedef typename thrust::detail::minimum_type<traversal1,traversal2>::type traversal;
+
+  return thrust::system::omp::detail::partition_detail::stable_partition(exec, first, last, stencil, pred, traversal());
 } // end stable_partition()
 
 
@@ -76,8 +338,7 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return thrust::system::omp::detail::compact(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 
@@ -96,8 +357,7 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return thrust::system::omp::detail::compact(exec, first, last, stencil, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 
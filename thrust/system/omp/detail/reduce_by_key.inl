@@ -16,8 +16,19 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/function_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/reduce.h>
 #include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/pair.h>
+#include <thrust/detail/cstdint.h>
 
 namespace thrust
 {
@@ -27,6 +38,22 @@ namespace omp
 {
 namespace detail
 {
+namespace reduce_by_key_detail
+{
+
+
+template<typename InputIterator, typename BinaryFunction>
+  struct partial_sum_type
+    : thrust::detail::eval_if<
+        thrust::detail::has_result_type<BinaryFunction>::value,
+        thrust::detail::result_type<BinaryFunction>,
+        thrust::iterator_value<InputIterator>
+      >
+{};
+
+
+} // end namespace reduce_by_key_detail
+
 
 template <typename DerivedPolicy,
           typename InputIterator1,
@@ -45,8 +72,158 @@ template <typename DerivedPolicy,
                   BinaryPredicate binary_pred,
                   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type                      Size;
+  typedef typename reduce_by_key_detail::partial_sum_type<InputIterator2,BinaryFunction>::type ValueType;
+
+  const Size n = thrust::distance(keys_first, keys_last);
+
+  if(n == 0)
+    return thrust::make_pair(keys_output, values_output);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  if(num_intervals == 1)
+  {
+    return thrust::reduce_by_key(thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  // each interval writes the segments which end inside it. the segment which
+  // ends inside an interval may have begun in an earlier interval, so each
+  // interval also carries the sum of its unfinished trailing segment forward
+  thrust::detail::temporary_array<Size,DerivedPolicy>      offsets_storage(exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size,DerivedPolicy>      carry_begins_storage(exec, num_intervals);
+  thrust::detail::temporary_array<Size,DerivedPolicy>      carry_keys_storage(exec, num_intervals);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries_storage(exec, num_intervals);
+
+  Size      *offsets      = thrust::raw_pointer_cast(&*offsets_storage.begin());
+  Size      *carry_begins = thrust::raw_pointer_cast(&*carry_begins_storage.begin());
+  Size      *carry_keys   = thrust::raw_pointer_cast(&*carry_keys_storage.begin());
+  ValueType *carries      = thrust::raw_pointer_cast(&*carries_storage.begin());
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool>     wrapped_binary_pred(binary_pred);
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  // count the segments which end in each interval and sum its trailing segment
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    const Size end = decomp[i].end();
+
+    Size count       = 0;
+    Size carry_begin = decomp[i].begin();
+
+    for(Size j = decomp[i].begin(); j < end; ++j)
+    {
+      if(j + 1 == n || !wrapped_binary_pred(keys_first[j], keys_first[j + 1]))
+      {
+        ++count;
+        carry_begin = j + 1;
+      }
+    }
+
+    offsets[i + 1]  = count;
+    carry_begins[i] = carry_begin;
+
+    if(carry_begin < end)
+    {
+      ValueType sum = values_first[carry_begin];
+
+      for(Size j = carry_begin + 1; j < end; ++j)
+      {
+        sum = wrapped_binary_op(sum, values_first[j]);
+      }
+
+      carries[i] = sum;
+    }
+  }
+
+  // serially scan the counts and turn each interval's outgoing carry into its
+  // successor's incoming carry. a carry passes through intervals which lie
+  // entirely inside its segment
+  offsets[0] = 0;
+
+  Size      carry_key = 0;
+  ValueType carry     = ValueType();
+
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    offsets[i + 1] += offsets[i];
+
+    ValueType trailing = carries[i];
+
+    carries[i]    = carry;
+    carry_keys[i] = carry_key;
+
+    if(carry_begins[i] < decomp[i].end())
+    {
+      if(carry_begins[i] == decomp[i].begin() && i > 0 && carry_begins[i - 1] < decomp[i - 1].end())
+      {
+        carry = wrapped_binary_op(carry, trailing);
+      }
+      else
+      {
+        carry     = trailing;
+        carry_key = carry_begins[i];
+      }
+    }
+  }
+
+  // reduce the finished segments of each interval into place
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    const Size carry_begin = carry_begins[i];
+
+    Size j      = decomp[i].begin();
+    Size result = offsets[i];
+
+    if(j < carry_begin && i > 0 && carry_begins[i - 1] < decomp[i - 1].end())
+    {
+      // finish the segment carried in from earlier intervals
+      ValueType sum = carries[i];
+
+      bool is_tail = false;
+
+      for(; !is_tail; ++j)
+      {
+        sum = wrapped_binary_op(sum, values_first[j]);
+
+        is_tail = (j + 1 == n) || !wrapped_binary_pred(keys_first[j], keys_first[j + 1]);
+      }
+
+      keys_output[result]   = keys_first[carry_keys[i]];
+      values_output[result] = sum;
+
+      ++result;
+    }
+
+    thrust::reduce_by_key(thrust::seq,
+                          keys_first + j, keys_first + carry_begin,
+                          values_first + j,
+                          keys_output + result,
+                          values_output + result,
+                          binary_pred,
+                          binary_op);
+  }
+
+  thrust::advance(keys_output,   offsets[num_intervals]);
+  thrust::advance(values_output, offsets[num_intervals]);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(keys_output, values_output);
 } // end reduce_by_key()
 
 
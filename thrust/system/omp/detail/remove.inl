@@ -19,6 +19,16 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/remove.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/copy.h>
+#include <thrust/detail/cstdint.h>
 
 namespace thrust
 {
@@ -37,8 +47,7 @@ template<typename DerivedPolicy,
                             ForwardIterator last,
                             Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
+  return thrust::system::omp::detail::remove_if(exec, first, last, first, pred);
 }
 
 
@@ -52,8 +61,78 @@ template<typename DerivedPolicy,
                             InputIterator stencil,
                             Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<ForwardIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename thrust::iterator_difference<ForwardIterator>::type Size;
+
+  const Size n = thrust::distance(first, last);
+
+  if(n == 0)
+    return first;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  // one counter per interval is the only temporary storage
+  thrust::detail::temporary_array<Size,DerivedPolicy> counts_storage(exec, num_intervals);
+  Size *counts = thrust::raw_pointer_cast(&*counts_storage.begin());
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  // compact the survivors of each interval to the front of that interval
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    ForwardIterator result = first + decomp[i].begin();
+
+    for(Size j = decomp[i].begin(); j < decomp[i].end(); ++j)
+    {
+      if(!wrapped_pred(stencil[j]))
+      {
+        *result = first[j];
+        ++result;
+      }
+    }
+
+    counts[i] = result - (first + decomp[i].begin());
+  }
+
+  // slide the survivors of each interval down behind those of its predecessors.
+  // a destination can only overlap the survivors of earlier intervals, which
+  // have already moved when the intervals are visited in order
+  Size num_kept = counts[0];
+
+  for(index_type i = 1; i < num_intervals; i++)
+  {
+    const Size begin = decomp[i].begin();
+
+    if(begin - num_kept >= counts[i])
+    {
+      // the ranges are disjoint
+      thrust::copy(exec, first + begin, first + begin + counts[i], first + num_kept);
+    }
+    else if(begin != num_kept)
+    {
+      thrust::copy(thrust::seq, first + begin, first + begin + counts[i], first + num_kept);
+    }
+
+    num_kept += counts[i];
+  }
+
+  thrust::advance(first, num_kept);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return first;
 }
 
 
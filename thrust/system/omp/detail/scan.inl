@@ -0,0 +1,298 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/function_traits.h>
+#include <thrust/detail/type_traits/iterator/is_output_iterator.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+
+// scans each interval of decomp independently, seeding interval i
+// with carries[i - 1] (or with nothing at all for the first interval)
+template<typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction,
+         typename ValueType,
+         typename Decomposition>
+void inclusive_scan_intervals(InputIterator first,
+                              OutputIterator result,
+                              BinaryFunction binary_op,
+                              const ValueType *carries,
+                              Decomposition decomp)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    InputIterator  iter1 = first  + decomp[i].begin();
+    InputIterator  last1 = first  + decomp[i].end();
+    OutputIterator iter2 = result + decomp[i].begin();
+
+    if(iter1 != last1)
+    {
+      ValueType sum = *iter1;
+
+      if(i > 0)
+      {
+        sum = wrapped_binary_op(carries[i - 1], sum);
+      }
+
+      *iter2 = sum;
+
+      for(++iter1, ++iter2; iter1 != last1; ++iter1, ++iter2)
+      {
+        *iter2 = sum = wrapped_binary_op(sum, *iter1);
+      }
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+// scans each interval of decomp independently, seeding interval i
+// with carries[i]
+template<typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction,
+         typename ValueType,
+         typename Decomposition>
+void exclusive_scan_intervals(InputIterator first,
+                              OutputIterator result,
+                              BinaryFunction binary_op,
+                              const ValueType *carries,
+                              Decomposition decomp)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    InputIterator  iter1 = first  + decomp[i].begin();
+    InputIterator  last1 = first  + decomp[i].end();
+    OutputIterator iter2 = result + decomp[i].begin();
+
+    ValueType sum = carries[i];
+
+    for(; iter1 != last1; ++iter1, ++iter2)
+    {
+      ValueType tmp = *iter1;  // temporary value allows in-situ scan
+      *iter2 = sum;
+      sum = wrapped_binary_op(sum, tmp);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end scan_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  // the pseudocode for deducing the type of the temporary used below:
+  // 
+  // if BinaryFunction is AdaptableBinaryFunction
+  //   TemporaryType = AdaptableBinaryFunction::result_type
+  // else if OutputIterator is a "pure" output iterator
+  //   TemporaryType = InputIterator::value_type
+  // else
+  //   TemporaryType = OutputIterator::value_type
+  //
+  // XXX upon c++0x, TemporaryType needs to be:
+  // result_of_adaptable_function<BinaryFunction>::type
+
+  using namespace thrust::detail;
+
+  typedef typename eval_if<
+    has_result_type<BinaryFunction>::value,
+    result_type<BinaryFunction>,
+    eval_if<
+      is_output_iterator<OutputIterator>::value,
+      thrust::iterator_value<InputIterator>,
+      thrust::iterator_value<OutputIterator>
+    >
+  >::type ValueType;
+
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(n == 0)
+    return result;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // reduce each interval in parallel
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> partial_sums(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, partial_sums.begin(), binary_op, decomp);
+
+  // scan the (few) partial sums serially
+  ValueType *carries = thrust::raw_pointer_cast(&*partial_sums.begin());
+
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  for(difference_type i = 1; i < decomp.size(); ++i)
+  {
+    carries[i] = wrapped_binary_op(carries[i - 1], carries[i]);
+  }
+
+  // rescan each interval in parallel, seeded by its predecessors' sum
+  scan_detail::inclusive_scan_intervals(first, result, binary_op, carries, decomp);
+
+  thrust::advance(result, n);
+
+  return result;
+} // end inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename T,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                T init,
+                                BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  // the pseudocode for deducing the type of the temporary used below:
+  // 
+  // if BinaryFunction is AdaptableBinaryFunction
+  //   TemporaryType = AdaptableBinaryFunction::result_type
+  // else if OutputIterator is a "pure" output iterator
+  //   TemporaryType = InputIterator::value_type
+  // else
+  //   TemporaryType = OutputIterator::value_type
+  //
+  // XXX upon c++0x, TemporaryType needs to be:
+  // result_of_adaptable_function<BinaryFunction>::type
+
+  using namespace thrust::detail;
+
+  typedef typename eval_if<
+    has_result_type<BinaryFunction>::value,
+    result_type<BinaryFunction>,
+    eval_if<
+      is_output_iterator<OutputIterator>::value,
+      thrust::iterator_value<InputIterator>,
+      thrust::iterator_value<OutputIterator>
+    >
+  >::type ValueType;
+
+  typedef typename thrust::iterator_difference<InputIterator>::type difference_type;
+
+  const difference_type n = thrust::distance(first, last);
+
+  if(n == 0)
+    return result;
+
+  thrust::system::detail::internal::uniform_decomposition<difference_type> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // reduce each interval in parallel
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> partial_sums(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, partial_sums.begin(), binary_op, decomp);
+
+  // exclusive scan the (few) partial sums serially, beginning with init
+  ValueType *carries = thrust::raw_pointer_cast(&*partial_sums.begin());
+
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  ValueType sum = init;
+
+  for(difference_type i = 0; i < decomp.size(); ++i)
+  {
+    ValueType tmp = carries[i];
+    carries[i] = sum;
+    sum = wrapped_binary_op(sum, tmp);
+  }
+
+  // rescan each interval in parallel, seeded by its predecessors' sum
+  scan_detail::exclusive_scan_intervals(first, result, binary_op, carries, decomp);
+
+  thrust::advance(result, n);
+
+  return result;
+} // end exclusive_scan()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
@@ -0,0 +1,328 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/scan.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/detail/cstdint.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+  typedef typename thrust::iterator_traits<InputIterator1>::value_type KeyType;
+  typedef typename thrust::iterator_traits<OutputIterator>::value_type ValueType;
+
+  const Size n = thrust::distance(first1, last1);
+
+  if(n == 0)
+    return result;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  if(num_intervals == 1)
+  {
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+  // each interval reduces its trailing segment and notes whether its leading
+  // segment continues one which began in an earlier interval
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries_storage(exec, num_intervals);
+  thrust::detail::temporary_array<bool,DerivedPolicy>      continues_storage(exec, num_intervals);
+  thrust::detail::temporary_array<bool,DerivedPolicy>      resets_storage(exec, num_intervals);
+
+  ValueType *carries   = thrust::raw_pointer_cast(&*carries_storage.begin());
+  bool      *continues = thrust::raw_pointer_cast(&*continues_storage.begin());
+  bool      *resets    = thrust::raw_pointer_cast(&*resets_storage.begin());
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool>     wrapped_binary_pred(binary_pred);
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    KeyType   prev_key = first1[begin];
+    ValueType sum      = first2[begin];
+    bool      reset    = false;
+
+    for(Size j = begin + 1; j < end; ++j)
+    {
+      KeyType key = first1[j];
+
+      if(wrapped_binary_pred(prev_key, key))
+      {
+        sum = wrapped_binary_op(sum, first2[j]);
+      }
+      else
+      {
+        sum   = first2[j];
+        reset = true;
+      }
+
+      prev_key = key;
+    }
+
+    carries[i]   = sum;
+    resets[i]    = reset;
+    continues[i] = (begin > 0) && wrapped_binary_pred(first1[begin - 1], first1[begin]);
+  }
+
+  // serially turn each interval's trailing sum into its successor's incoming carry
+  ValueType carry = carries[0];
+
+  for(index_type i = 1; i < num_intervals; i++)
+  {
+    ValueType trailing = carries[i];
+
+    carries[i] = carry;
+
+    carry = (continues[i] && !resets[i]) ? wrapped_binary_op(carry, trailing) : trailing;
+  }
+
+  // rescan each interval, seeding its leading segment with the incoming carry
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    KeyType   prev_key = first1[begin];
+    ValueType sum      = continues[i] ? wrapped_binary_op(carries[i], first2[begin]) : ValueType(first2[begin]);
+
+    result[begin] = sum;
+
+    for(Size j = begin + 1; j < end; ++j)
+    {
+      KeyType key = first1[j];
+
+      if(wrapped_binary_pred(prev_key, key))
+      {
+        sum = wrapped_binary_op(sum, first2[j]);
+      }
+      else
+      {
+        sum = first2[j];
+      }
+
+      result[j] = sum;
+
+      prev_key = key;
+    }
+  }
+
+  thrust::advance(result, n);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result;
+} // end inclusive_scan_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       T init,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+  typedef typename thrust::iterator_traits<InputIterator1>::value_type KeyType;
+  typedef typename thrust::iterator_traits<OutputIterator>::value_type ValueType;
+
+  const Size n = thrust::distance(first1, last1);
+
+  if(n == 0)
+    return result;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  if(num_intervals == 1)
+  {
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+  // each interval reduces its trailing segment and notes whether its leading
+  // segment continues one which began in an earlier interval
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries_storage(exec, num_intervals);
+  thrust::detail::temporary_array<bool,DerivedPolicy>      continues_storage(exec, num_intervals);
+  thrust::detail::temporary_array<bool,DerivedPolicy>      resets_storage(exec, num_intervals);
+
+  ValueType *carries   = thrust::raw_pointer_cast(&*carries_storage.begin());
+  bool      *continues = thrust::raw_pointer_cast(&*continues_storage.begin());
+  bool      *resets    = thrust::raw_pointer_cast(&*resets_storage.begin());
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool>     wrapped_binary_pred(binary_pred);
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  const ValueType init_value = init;
+
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    continues[i] = (begin > 0) && wrapped_binary_pred(first1[begin - 1], first1[begin]);
+
+    // the sum of the leading segment includes init only if it begins here
+    KeyType   prev_key = first1[begin];
+    ValueType sum      = continues[i] ? ValueType(first2[begin]) : wrapped_binary_op(init_value, first2[begin]);
+    bool      reset    = false;
+
+    for(Size j = begin + 1; j < end; ++j)
+    {
+      KeyType key = first1[j];
+
+      if(wrapped_binary_pred(prev_key, key))
+      {
+        sum = wrapped_binary_op(sum, first2[j]);
+      }
+      else
+      {
+        sum   = wrapped_binary_op(init_value, first2[j]);
+        reset = true;
+      }
+
+      prev_key = key;
+    }
+
+    carries[i] = sum;
+    resets[i]  = reset;
+  }
+
+  // serially turn each interval's trailing sum into its successor's incoming carry
+  ValueType carry = carries[0];
+
+  for(index_type i = 1; i < num_intervals; i++)
+  {
+    ValueType trailing = carries[i];
+
+    carries[i] = carry;
+
+    carry = (continues[i] && !resets[i]) ? wrapped_binary_op(carry, trailing) : trailing;
+  }
+
+  // rescan each interval, seeding its leading segment with the incoming carry
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    const Size begin = decomp[i].begin();
+    const Size end   = decomp[i].end();
+
+    KeyType   prev_key = first1[begin];
+    ValueType sum      = continues[i] ? carries[i] : init_value;
+
+    for(Size j = begin; j < end; ++j)
+    {
+      KeyType key = first1[j];
+
+      if(j > begin && !wrapped_binary_pred(prev_key, key))
+      {
+        sum = init_value;
+      }
+
+      // use a temporary to permit in-place scans
+      ValueType value = first2[j];
+
+      result[j] = sum;
+
+      sum = wrapped_binary_op(sum, value);
+
+      prev_key = key;
+    }
+  }
+
+  thrust::advance(result, n);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result;
+} // end exclusive_scan_by_key()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
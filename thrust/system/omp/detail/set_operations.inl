@@ -0,0 +1,221 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/set_operations.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/pair.h>
+#include <thrust/detail/cstdint.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering,
+         typename SetOperation>
+OutputIterator set_operation(execution_policy<DerivedPolicy> &exec,
+                             InputIterator1 first1,
+                             InputIterator1 last1,
+                             InputIterator2 first2,
+                             InputIterator2 last2,
+                             OutputIterator result,
+                             StrictWeakOrdering comp,
+                             SetOperation set_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<InputIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  const Size n1 = thrust::distance(first1, last1);
+  const Size n2 = thrust::distance(first2, last2);
+
+  if(n1 + n2 == 0)
+    return result;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // split the merged inputs evenly and find where each split falls in the inputs
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n1 + n2);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  index_type num_intervals = static_cast<index_type>(decomp.size());
+
+  // a single interval needs neither the split nor the counting pass
+  if(num_intervals == 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> splits1_storage(exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size,DerivedPolicy> splits2_storage(exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_intervals + 1);
+
+  Size *splits1 = thrust::raw_pointer_cast(&*splits1_storage.begin());
+  Size *splits2 = thrust::raw_pointer_cast(&*splits2_storage.begin());
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+# pragma omp parallel for
+  for(index_type i = 0; i <= num_intervals; i++)
+  {
+    Size diag = (i < num_intervals) ? decomp[i].begin() : n1 + n2;
+
+    thrust::pair<Size,Size> split = thrust::system::detail::internal::balanced_path(diag, first1, n1, first2, n2, comp);
+
+    splits1[i] = split.first;
+    splits2[i] = split.second;
+  }
+
+  // count the output of each interval
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    thrust::discard_iterator<> discard;
+
+    offsets[i + 1] = set_op(first1 + splits1[i], first1 + splits1[i + 1],
+                            first2 + splits2[i], first2 + splits2[i + 1],
+                            discard,
+                            comp) - discard;
+  }
+
+  // scan the (few) counts serially
+  offsets[0] = 0;
+
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+
+  // write the output of each interval at its offset
+# pragma omp parallel for
+  for(index_type i = 0; i < num_intervals; i++)
+  {
+    set_op(first1 + splits1[i], first1 + splits1[i + 1],
+           first2 + splits2[i], first2 + splits2[i + 1],
+           result + offsets[i],
+           comp);
+  }
+
+  thrust::advance(result, offsets[num_intervals]);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result;
+} // end set_operation()
+
+
+} // end namespace set_operations_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_difference(execution_policy<DerivedPolicy> &exec,
+                              InputIterator1 first1,
+                              InputIterator1 last1,
+                              InputIterator2 first2,
+                              InputIterator2 last2,
+                              OutputIterator result,
+                              StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference());
+} // end set_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_intersection(execution_policy<DerivedPolicy> &exec,
+                                InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection());
+} // end set_intersection()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(execution_policy<DerivedPolicy> &exec,
+                                        InputIterator1 first1,
+                                        InputIterator1 last1,
+                                        InputIterator2 first2,
+                                        InputIterator2 last2,
+                                        OutputIterator result,
+                                        StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_union(execution_policy<DerivedPolicy> &exec,
+                         InputIterator1 first1,
+                         InputIterator1 last1,
+                         InputIterator2 first2,
+                         InputIterator2 last2,
+                         OutputIterator result,
+                         StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union());
+} // end set_union()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
@@ -18,6 +18,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/par.h>
 
 namespace thrust
 {
@@ -46,6 +47,22 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
                         RandomAccessIterator2 values_first,
                         StrictWeakOrdering comp);
 
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execute_with_bounded_memory &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp);
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execute_with_bounded_memory &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -16,18 +16,22 @@
 
 
 #include <thrust/detail/config.h>
-
-// don't attempt to #include this file without omp support
-#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-#include <omp.h>
-#endif // omp support
-
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/select_system.h>
 #include <thrust/sort.h>
 #include <thrust/merge.h>
+#include <thrust/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/bounded_merge_sort.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/omp/detail/stable_radix_sort.h>
+#include <thrust/reverse.h>
 
 namespace thrust
 {
@@ -41,62 +45,97 @@ namespace sort_detail
 {
 
 
-template<typename DerivedPolicy,
-         typename RandomAccessIterator,
+// returns the beginning of tile i, or the end of the last tile if i is past the end
+template<typename Decomposition>
+typename Decomposition::index_type tile_begin(const Decomposition &decomp, typename Decomposition::index_type i)
+{
+  return (i < decomp.size()) ? decomp[i].begin() : decomp[decomp.size() - 1].end();
+}
+
+
+// produces interval i of the output of a merge pass in which sorted runs of
+// run_width tiles each are merged pairwise. each interval is co-ranked against
+// the pair of runs it falls within, so that all intervals may be merged independently
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition,
          typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy> &exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+void merge_pass_interval(RandomAccessIterator1 first,
+                         RandomAccessIterator2 result,
+                         const Decomposition &decomp,
+                         typename Decomposition::index_type run_width,
+                         typename Decomposition::index_type i,
+                         StrictWeakOrdering comp)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  typedef typename Decomposition::index_type index_type;
+
+  index_type pair_tile = (i / (2 * run_width)) * (2 * run_width);
+
+  index_type begin1 = tile_begin(decomp, pair_tile);
+  index_type begin2 = tile_begin(decomp, pair_tile + run_width);
+  index_type end2   = tile_begin(decomp, pair_tile + 2 * run_width);
 
-  thrust::detail::temporary_array<value_type,DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type,DerivedPolicy> b(exec, middle, last);
+  index_type diag_begin = decomp[i].begin() - begin1;
+  index_type diag_end   = decomp[i].end()   - begin1;
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  index_type lhs_begin = thrust::system::detail::internal::merge_path(diag_begin, first + begin1, begin2 - begin1, first + begin2, end2 - begin2, comp);
+  index_type lhs_end   = thrust::system::detail::internal::merge_path(diag_end,   first + begin1, begin2 - begin1, first + begin2, end2 - begin2, comp);
+
+  thrust::merge(thrust::seq,
+                first + begin1 + lhs_begin,              first + begin1 + lhs_end,
+                first + begin2 + (diag_begin - lhs_begin), first + begin2 + (diag_end - lhs_end),
+                result + decomp[i].begin(),
+                comp);
 }
 
 
-template<typename DerivedPolicy,
-         typename RandomAccessIterator1,
+template<typename RandomAccessIterator1,
          typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition,
          typename StrictWeakOrdering>
-void inplace_merge_by_key(execution_policy<DerivedPolicy> &exec,
-                          RandomAccessIterator1 first1,
-                          RandomAccessIterator1 middle1,
-                          RandomAccessIterator1 last1,
-                          RandomAccessIterator2 first2,
-                          StrictWeakOrdering comp)
+void merge_pass_interval_by_key(RandomAccessIterator1 keys_first,
+                                RandomAccessIterator2 values_first,
+                                RandomAccessIterator3 keys_result,
+                                RandomAccessIterator4 values_result,
+                                const Decomposition &decomp,
+                                typename Decomposition::index_type run_width,
+                                typename Decomposition::index_type i,
+                                StrictWeakOrdering comp)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type1;
-  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type2;
+  typedef typename Decomposition::index_type index_type;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1   - first1);
+  index_type pair_tile = (i / (2 * run_width)) * (2 * run_width);
 
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> rhs2(exec, middle2, last2);
+  index_type begin1 = tile_begin(decomp, pair_tile);
+  index_type begin2 = tile_begin(decomp, pair_tile + run_width);
+  index_type end2   = tile_begin(decomp, pair_tile + 2 * run_width);
+
+  index_type diag_begin = decomp[i].begin() - begin1;
+  index_type diag_end   = decomp[i].end()   - begin1;
+
+  index_type lhs_begin = thrust::system::detail::internal::merge_path(diag_begin, keys_first + begin1, begin2 - begin1, keys_first + begin2, end2 - begin2, comp);
+  index_type lhs_end   = thrust::system::detail::internal::merge_path(diag_end,   keys_first + begin1, begin2 - begin1, keys_first + begin2, end2 - begin2, comp);
+
+  index_type rhs_begin = diag_begin - lhs_begin;
+  index_type rhs_end   = diag_end   - lhs_end;
 
   thrust::merge_by_key(thrust::seq,
-                       lhs1.begin(), lhs1.end(),
-                       rhs1.begin(), rhs1.end(),
-                       lhs2.begin(), rhs2.begin(),
-                       first1, first2,
+                       keys_first + begin1 + lhs_begin, keys_first + begin1 + lhs_end,
+                       keys_first + begin2 + rhs_begin, keys_first + begin2 + rhs_end,
+                       values_first + begin1 + lhs_begin,
+                       values_first + begin2 + rhs_begin,
+                       keys_result + decomp[i].begin(),
+                       values_result + decomp[i].begin(),
                        comp);
 }
 
 
-} // end sort_detail
-
-
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
-void stable_sort(execution_policy<DerivedPolicy> &exec,
+void stable_merge_sort(execution_policy<DerivedPolicy> &exec,
                  RandomAccessIterator first,
                  RandomAccessIterator last,
                  StrictWeakOrdering comp)
@@ -111,58 +150,67 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
   
   if(first == last)
     return;
 
-  #pragma omp parallel
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition<IndexType>(last - first);
+
+  if(decomp.size() == 1)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  // merge passes ping-pong between the input and this buffer
+  thrust::detail::temporary_array<value_type,DerivedPolicy> buffer(exec, last - first);
 
+  const IndexType num_tiles = decomp.size();
+
+  #pragma omp parallel
+  {
     // every thread sorts its own tile
-    if(p_i < decomp.size())
+    #pragma omp for
+    for(IndexType i = 0; i < num_tiles; ++i)
     {
       thrust::stable_sort(thrust::seq,
-                          first + decomp[p_i].begin(),
-                          first + decomp[p_i].end(),
+                          first + decomp[i].begin(),
+                          first + decomp[i].end(),
                           comp);
     }
 
-    #pragma omp barrier
+    // every pass merges pairs of runs, with all threads sharing the output of each pass
+    bool sorted_in_buffer = false;
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
-
-    while(nseg>1)
+    for(IndexType run_width = 1; run_width < num_tiles; run_width *= 2)
     {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
-
-      if((p_i % h) == 0 && c > b)
+      #pragma omp for
+      for(IndexType i = 0; i < num_tiles; ++i)
       {
-        sort_detail::inplace_merge(exec,
-                                   first + decomp[a].begin(),
-                                   first + decomp[b].end(),
-                                   first + decomp[c].end(),
-                                   comp);
-
-        b = c;
-        c += h;
+        if(sorted_in_buffer)
+        {
+          sort_detail::merge_pass_interval(buffer.begin(), first, decomp, run_width, i, comp);
+        }
+        else
+        {
+          sort_detail::merge_pass_interval(first, buffer.begin(), decomp, run_width, i, comp);
+        }
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      sorted_in_buffer = !sorted_in_buffer;
+    }
 
-      #pragma omp barrier
+    if(sorted_in_buffer)
+    {
+      #pragma omp for
+      for(IndexType i = 0; i < num_tiles; ++i)
+      {
+        thrust::copy(thrust::seq,
+                     buffer.begin() + decomp[i].begin(),
+                     buffer.begin() + decomp[i].end(),
+                     first + decomp[i].begin());
+      }
     }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
@@ -173,7 +221,7 @@ template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename StrictWeakOrdering>
-void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+void stable_merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
                         RandomAccessIterator1 keys_first,
                         RandomAccessIterator1 keys_last,
                         RandomAccessIterator2 values_first,
@@ -189,66 +237,405 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      value_type1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      value_type2;
   
   if(keys_first == keys_last)
     return;
 
-  #pragma omp parallel
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition<IndexType>(keys_last - keys_first);
+
+  if(decomp.size() == 1)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(keys_last - keys_first, 1, omp_get_num_threads());
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  // merge passes ping-pong between the input and these buffers
+  thrust::detail::temporary_array<value_type1,DerivedPolicy> keys_buffer(exec, keys_last - keys_first);
+  thrust::detail::temporary_array<value_type2,DerivedPolicy> values_buffer(exec, keys_last - keys_first);
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
+  const IndexType num_tiles = decomp.size();
 
+  #pragma omp parallel
+  {
     // every thread sorts its own tile
-    if(p_i < decomp.size())
+    #pragma omp for
+    for(IndexType i = 0; i < num_tiles; ++i)
     {
       thrust::stable_sort_by_key(thrust::seq,
-                                 keys_first + decomp[p_i].begin(),
-                                 keys_first + decomp[p_i].end(),
-                                 values_first + decomp[p_i].begin(),
+                                 keys_first + decomp[i].begin(),
+                                 keys_first + decomp[i].end(),
+                                 values_first + decomp[i].begin(),
                                  comp);
     }
 
-    #pragma omp barrier
+    // every pass merges pairs of runs, with all threads sharing the output of each pass
+    bool sorted_in_buffer = false;
+
+    for(IndexType run_width = 1; run_width < num_tiles; run_width *= 2)
+    {
+      #pragma omp for
+      for(IndexType i = 0; i < num_tiles; ++i)
+      {
+        if(sorted_in_buffer)
+        {
+          sort_detail::merge_pass_interval_by_key(keys_buffer.begin(), values_buffer.begin(), keys_first, values_first, decomp, run_width, i, comp);
+        }
+        else
+        {
+          sort_detail::merge_pass_interval_by_key(keys_first, values_first, keys_buffer.begin(), values_buffer.begin(), decomp, run_width, i, comp);
+        }
+      }
+
+      sorted_in_buffer = !sorted_in_buffer;
+    }
 
-    // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
-    ;
+    if(sorted_in_buffer)
+    {
+      #pragma omp for
+      for(IndexType i = 0; i < num_tiles; ++i)
+      {
+        thrust::copy(thrust::seq,
+                     keys_buffer.begin() + decomp[i].begin(),
+                     keys_buffer.begin() + decomp[i].end(),
+                     keys_first + decomp[i].begin());
+
+        thrust::copy(thrust::seq,
+                     values_buffer.begin() + decomp[i].begin(),
+                     values_buffer.begin() + decomp[i].end(),
+                     values_first + decomp[i].begin());
+      }
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
 
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
 
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
+/////////////////////////
+// Bounded Memory Sort //
+/////////////////////////
+
+
+// reverses [first, last) with every thread exchanging a share of the elements
+template<typename RandomAccessIterator>
+void parallel_reverse(RandomAccessIterator first, RandomAccessIterator last)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  const IndexType half = (last - first) / 2;
+
+  // small ranges are not worth a parallel region
+  if(half < (1 << 14))
+  {
+    thrust::system::detail::internal::bounded_merge_sort_detail::reverse(first, last);
+    return;
+  }
+
+  #pragma omp parallel for
+  for(IndexType i = 0; i < half; ++i)
+  {
+    thrust::system::detail::internal::bounded_merge_sort_detail::exchange(first + i, last - 1 - i);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+struct parallel_rotate
+{
+  template<typename RandomAccessIterator>
+  void operator()(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+  {
+    parallel_reverse(first, middle);
+    parallel_reverse(middle, last);
+    parallel_reverse(first, last);
+  }
+};
+
+
+// a stable merge sort whose temporary storage is at most scratch_fraction * n elements.
+// every tile is sorted with its own slice of the scratch. every merge pass splits each
+// pair of runs into one piece per tile, moves each piece's parts together with
+// rotations, and merges the pieces in place, each with its own slice of the scratch
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void bounded_stable_merge_sort(execution_policy<DerivedPolicy> &exec,
+                               RandomAccessIterator first,
+                               RandomAccessIterator last,
+                               StrictWeakOrdering comp,
+                               double scratch_fraction)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+
+  namespace internal = thrust::system::detail::internal;
+
+  const IndexType n = last - first;
+
+  if(n < 2) return;
+
+  // at least one tile per processor
+  const IndexType num_procs = thrust::system::omp::detail::default_decomposition<IndexType>(n).size();
+
+  internal::uniform_decomposition<IndexType> decomp(n, 1, internal::bounded_sort_num_tiles(n, num_procs));
+
+  const IndexType num_tiles = decomp.size();
+
+  IndexType scratch = (scratch_fraction > 0) ? static_cast<IndexType>(scratch_fraction * n) : 0;
+  if(scratch > n) scratch = n;
+
+  const IndexType tile_scratch = scratch / num_tiles;
+
+  thrust::detail::temporary_array<value_type,DerivedPolicy> buffer(exec, tile_scratch * num_tiles);
+
+  #pragma omp parallel for
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    internal::buffered_merge_sort(first + decomp[i].begin(),
+                                  first + decomp[i].end(),
+                                  buffer.begin() + i * tile_scratch,
+                                  tile_scratch,
+                                  comp);
+  }
+
+  // splits[i] is the number of elements of tile i's first run which precede tile i in the merge
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> splits_storage(exec, num_tiles);
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> diag_storage(exec, num_tiles + 1);
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> lhs_storage(exec, num_tiles + 1);
+
+  IndexType *splits = thrust::raw_pointer_cast(&*splits_storage.begin());
+  IndexType *diag   = thrust::raw_pointer_cast(&*diag_storage.begin());
+  IndexType *lhs    = thrust::raw_pointer_cast(&*lhs_storage.begin());
+
+  parallel_rotate rotate;
+
+  for(IndexType run_width = 1; run_width < num_tiles; run_width *= 2)
+  {
+    #pragma omp parallel for
+    for(IndexType i = 0; i < num_tiles; ++i)
+    {
+      IndexType pair_tile = (i / (2 * run_width)) * (2 * run_width);
+
+      IndexType begin1 = tile_begin(decomp, pair_tile);
+      IndexType begin2 = tile_begin(decomp, pair_tile + run_width);
+      IndexType end2   = tile_begin(decomp, pair_tile + 2 * run_width);
+
+      splits[i] = internal::merge_path(decomp[i].begin() - begin1, first + begin1, begin2 - begin1, first + begin2, end2 - begin2, comp);
+    }
 
-    while(nseg>1)
+    for(IndexType pair_tile = 0; pair_tile + run_width < num_tiles; pair_tile += 2 * run_width)
     {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
+      IndexType num_pieces = thrust::min<IndexType>(2 * run_width, num_tiles - pair_tile);
 
-      if((p_i % h) == 0 && c > b)
+      IndexType begin1 = tile_begin(decomp, pair_tile);
+      IndexType begin2 = tile_begin(decomp, pair_tile + run_width);
+      IndexType end2   = tile_begin(decomp, pair_tile + 2 * run_width);
+
+      for(IndexType j = 0; j < num_pieces; ++j)
       {
-        sort_detail::inplace_merge_by_key(exec,
-                                          keys_first + decomp[a].begin(),
-                                          keys_first + decomp[b].end(),
-                                          keys_first + decomp[c].end(),
-                                          values_first + decomp[a].begin(),
-                                          comp);
-
-        b = c;
-        c += h;
+        diag[j] = decomp[pair_tile + j].begin() - begin1;
+        lhs[j]  = splits[pair_tile + j];
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      diag[num_pieces] = end2 - begin1;
+      lhs[num_pieces]  = begin2 - begin1;
+
+      internal::interleave_pieces(first + begin1, diag, lhs, IndexType(0), num_pieces, rotate);
+    }
+
+    #pragma omp parallel for
+    for(IndexType i = 0; i < num_tiles; ++i)
+    {
+      IndexType pair_tile = (i / (2 * run_width)) * (2 * run_width);
+
+      // a run without a partner is already in place
+      if(pair_tile + run_width >= num_tiles) continue;
+
+      IndexType begin1 = tile_begin(decomp, pair_tile);
+      IndexType begin2 = tile_begin(decomp, pair_tile + run_width);
+
+      IndexType next_split = (i + 1 < thrust::min<IndexType>(pair_tile + 2 * run_width, num_tiles)) ? splits[i + 1] : begin2 - begin1;
 
-      #pragma omp barrier
+      internal::buffered_merge(first + decomp[i].begin(),
+                               first + decomp[i].begin() + (next_split - splits[i]),
+                               first + decomp[i].end(),
+                               buffer.begin() + i * tile_scratch,
+                               tile_scratch,
+                               comp);
     }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
 
+////////////////
+// Radix Sort //
+////////////////
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering,
+                 thrust::detail::true_type)
+{
+  thrust::system::omp::detail::stable_radix_sort(exec, first, last);
+
+  // if comp is greater<T> then reverse the keys
+  typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
+
+  if(thrust::system::detail::internal::radix_sort_detail::needs_reverse<KeyType,StrictWeakOrdering>::value)
+  {
+    thrust::reverse(exec, first, last);
+  }
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering,
+                        thrust::detail::true_type)
+{
+  // if comp is greater<T> then reverse the keys and values
+  typedef typename thrust::iterator_traits<RandomAccessIterator1>::value_type KeyType;
+
+  const bool reverse = thrust::system::detail::internal::radix_sort_detail::needs_reverse<KeyType,StrictWeakOrdering>::value;
+
+  // note, we also have to reverse the (unordered) input to preserve stability
+  if(reverse)
+  {
+    thrust::reverse(exec, keys_first, keys_last);
+    thrust::reverse(exec, values_first, values_first + (keys_last - keys_first));
+  }
+
+  thrust::system::omp::detail::stable_radix_sort_by_key(exec, keys_first, keys_last, values_first);
+
+  if(reverse)
+  {
+    thrust::reverse(exec, keys_first, keys_last);
+    thrust::reverse(exec, values_first, values_first + (keys_last - keys_first));
+  }
+}
+
+
+////////////////
+// Merge Sort //
+////////////////
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
+{
+  sort_detail::stable_merge_sort(exec, first, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp,
+                        thrust::detail::false_type)
+{
+  sort_detail::stable_merge_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+}
+
+
+} // end sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<KeyType,StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_traits<RandomAccessIterator1>::value_type KeyType;
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<KeyType,StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp, use_radix_sort);
+}
+
+
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execute_with_bounded_memory &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  // radix sort needs scratch as large as its input, so every key type is merge sorted
+  sort_detail::bounded_stable_merge_sort(exec, first, last, comp, exec.m_scratch_fraction);
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execute_with_bounded_memory &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp)
+{
+  // sort the keys and values as pairs, so that the scratch holds pairs too
+  sort_detail::bounded_stable_merge_sort(exec,
+                                         thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
+                                         thrust::make_zip_iterator(thrust::make_tuple(keys_last, values_first + (keys_last - keys_first))),
+                                         thrust::detail::compare_first<StrictWeakOrdering>(comp),
+                                         exec.m_scratch_fraction);
+}
+
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -0,0 +1,179 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/stable_radix_sort.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/copy.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace radix_sort_detail
+{
+
+
+// sorts (keys1, vals1) using (keys2, vals2) as scratch space
+template<bool HasValues,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size>
+void radix_sort(execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                Size n)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  // one histogram per tile, reused by every pass
+  thrust::detail::temporary_array<size_t,DerivedPolicy> histograms_storage(exec, num_tiles * radix::radix_size);
+  size_t *histograms = thrust::raw_pointer_cast(&*histograms_storage.begin());
+
+  // true if the most recent data is stored in (keys2,vals2)
+  bool flip = false;
+
+  for(unsigned int pass = 0; pass < radix::radix_traits<KeyType>::num_passes; ++pass)
+  {
+    // count the digits of each tile
+#   pragma omp parallel for
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      if(flip)
+      {
+        radix::histogram_tile(keys2, decomp[t].begin(), decomp[t].end(), pass, histograms + t * radix::radix_size);
+      }
+      else
+      {
+        radix::histogram_tile(keys1, decomp[t].begin(), decomp[t].end(), pass, histograms + t * radix::radix_size);
+      }
+    }
+
+    // skip passes in which every key has the same digit
+    if(radix::scan_tile_histograms(histograms, num_tiles, static_cast<size_t>(n)))
+    {
+      continue;
+    }
+
+    // every tile scatters its keys to their positions within each digit's bucket
+#   pragma omp parallel for
+    for(Size t = 0; t < num_tiles; ++t)
+    {
+      if(flip)
+      {
+        radix::scatter_tile<HasValues>(keys2, vals2, keys1, vals1, decomp[t].begin(), decomp[t].end(), pass, histograms + t * radix::radix_size);
+      }
+      else
+      {
+        radix::scatter_tile<HasValues>(keys1, vals1, keys2, vals2, decomp[t].begin(), decomp[t].end(), pass, histograms + t * radix::radix_size);
+      }
+    }
+
+    flip = !flip;
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if(flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if(HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+
+} // end namespace radix_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+void stable_radix_sort(execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator first,
+                       RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  Size n = last - first;
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> temp(exec, n);
+
+  radix_sort_detail::radix_sort<false>(exec, first, temp.begin(), static_cast<int *>(0), static_cast<int *>(0), n);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+void stable_radix_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 keys_first,
+                              RandomAccessIterator1 keys_last,
+                              RandomAccessIterator2 values_first)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  Size n = keys_last - keys_first;
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   temp1(exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> temp2(exec, n);
+
+  radix_sort_detail::radix_sort<true>(exec, keys_first, temp1.begin(), values_first, temp2.begin(), n);
+}
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+} // end namespace thrust
+
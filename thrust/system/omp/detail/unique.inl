@@ -18,7 +18,16 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/unique.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/detail/internal/unique.h>
+#include <thrust/system/detail/internal/move_down.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/cstdint.h>
 #include <thrust/pair.h>
 
 namespace thrust
@@ -29,6 +38,8 @@ namespace omp
 {
 namespace detail
 {
+namespace unique_detail
+{
 
 
 template<typename DerivedPolicy,
@@ -37,13 +48,109 @@ template<typename DerivedPolicy,
   ForwardIterator unique(execution_policy<DerivedPolicy> &exec,
                          ForwardIterator first,
                          ForwardIterator last,
-                         BinaryPredicate binary_pred)
+                         BinaryPredicate binary_pred,
+                         thrust::incrementable_traversal_tag)
 {
   // omp prefers generic::unique to cpp::unique
   return thrust::system::detail::generic::unique(exec,first,last,binary_pred);
 } // end unique()
 
 
+// each tile's unique elements are counted and moved to its front, and the
+// tiles are then moved down, in order, to the places given by the scan of
+// their counts. only one counter per tile of temporary storage is needed
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BinaryPredicate>
+  RandomAccessIterator unique(execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator first,
+                              RandomAccessIterator last,
+                              BinaryPredicate binary_pred,
+                              thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  namespace internal = thrust::system::detail::internal::unique_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = last - first;
+
+  if(n == 0) return first;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_tiles + 1);
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_binary_pred(binary_pred);
+
+# pragma omp parallel
+  {
+#   pragma omp for schedule(static)
+    for(index_type i = 0; i < num_tiles; i++)
+    {
+      offsets[i + 1] = internal::count_heads_tile(first, decomp[i].begin(), decomp[i].end(), wrapped_binary_pred);
+    }
+
+#   pragma omp single
+    {
+      offsets[0] = 0;
+
+      for(index_type i = 0; i < num_tiles; i++)
+      {
+        offsets[i + 1] += offsets[i];
+      }
+    }
+
+#   pragma omp for schedule(static)
+    for(index_type i = 0; i < num_tiles; i++)
+    {
+      internal::unique_tile(first, decomp[i].begin(), decomp[i].end(), wrapped_binary_pred);
+    }
+  }
+
+  // each tile's destination lies below those of the tiles after it
+  for(index_type i = 1; i < num_tiles; i++)
+  {
+    thrust::system::detail::internal::move_down(exec, first, decomp[i].begin(), offsets[i], offsets[i + 1] - offsets[i]);
+  }
+
+  return first + offsets[num_tiles];
+#else
+  return first;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end unique()
+
+
+} // end unique_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+  ForwardIterator unique(execution_policy<DerivedPolicy> &exec,
+                         ForwardIterator first,
+                         ForwardIterator last,
+                         BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return thrust::system::omp::detail::unique_detail::unique(exec, first, last, binary_pred, traversal());
+} // end unique()
+
+
 template<typename DerivedPolicy,
          typename InputIterator,
          typename OutputIterator,
@@ -59,6 +166,20 @@ template<typename DerivedPolicy,
 } // end unique_copy()
 
 
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+  typename thrust::iterator_difference<ForwardIterator>::type
+    unique_count(execution_policy<DerivedPolicy> &exec,
+                 ForwardIterator first,
+                 ForwardIterator last,
+                 BinaryPredicate binary_pred)
+{
+  // omp prefers generic::unique_count to cpp::unique_count
+  return thrust::system::detail::generic::unique_count(exec,first,last,binary_pred);
+} // end unique_count()
+
+
 } // end namespace detail
 } // end namespace omp 
 } // end namespace system
@@ -19,6 +19,18 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/unique_by_key.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/omp/detail/reduce_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/unique.h>
+#include <thrust/system/detail/internal/move_down.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/cstdint.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/functional.h>
 #include <thrust/pair.h>
 
 namespace thrust
@@ -31,6 +43,10 @@ namespace detail
 {
 
 
+namespace unique_by_key_detail
+{
+
+
 template<typename DerivedPolicy,
          typename ForwardIterator1,
          typename ForwardIterator2,
@@ -40,13 +56,116 @@ template<typename DerivedPolicy,
                   ForwardIterator1 keys_first, 
                   ForwardIterator1 keys_last,
                   ForwardIterator2 values_first,
-                  BinaryPredicate binary_pred)
+                  BinaryPredicate binary_pred,
+                  thrust::incrementable_traversal_tag)
 {
-  // omp prefers generic::unique_by_key to cpp::unique_by_key
   return thrust::system::detail::generic::unique_by_key(exec,keys_first,keys_last,values_first,binary_pred);
 } // end unique_by_key()
 
 
+// unique_by_key compacts in place as unique does, moving values with keys
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BinaryPredicate>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    unique_by_key(execution_policy<DerivedPolicy> &exec,
+                  RandomAccessIterator1 keys_first, 
+                  RandomAccessIterator1 keys_last,
+                  RandomAccessIterator2 values_first,
+                  BinaryPredicate binary_pred,
+                  thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT( (thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value) );
+
+  namespace internal = thrust::system::detail::internal::unique_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = keys_last - keys_first;
+
+  if(n == 0) return thrust::make_pair(keys_first, values_first);
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  typedef thrust::detail::intptr_t index_type;
+
+  const index_type num_tiles = static_cast<index_type>(decomp.size());
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_tiles + 1);
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_binary_pred(binary_pred);
+
+# pragma omp parallel
+  {
+#   pragma omp for schedule(static)
+    for(index_type i = 0; i < num_tiles; i++)
+    {
+      offsets[i + 1] = internal::count_heads_tile(keys_first, decomp[i].begin(), decomp[i].end(), wrapped_binary_pred);
+    }
+
+#   pragma omp single
+    {
+      offsets[0] = 0;
+
+      for(index_type i = 0; i < num_tiles; i++)
+      {
+        offsets[i + 1] += offsets[i];
+      }
+    }
+
+#   pragma omp for schedule(static)
+    for(index_type i = 0; i < num_tiles; i++)
+    {
+      internal::unique_by_key_tile(keys_first, values_first, decomp[i].begin(), decomp[i].end(), wrapped_binary_pred);
+    }
+  }
+
+  // each tile's destination lies below those of the tiles after it
+  for(index_type i = 1; i < num_tiles; i++)
+  {
+    thrust::system::detail::internal::move_down(exec, keys_first,   decomp[i].begin(), offsets[i], offsets[i + 1] - offsets[i]);
+    thrust::system::detail::internal::move_down(exec, values_first, decomp[i].begin(), offsets[i], offsets[i + 1] - offsets[i]);
+  }
+
+  return thrust::make_pair(keys_first + offsets[num_tiles], values_first + offsets[num_tiles]);
+#else
+  return thrust::make_pair(keys_first, values_first);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+} // end unique_by_key()
+
+
+} // end unique_by_key_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator1,
+         typename ForwardIterator2,
+         typename BinaryPredicate>
+  thrust::pair<ForwardIterator1,ForwardIterator2>
+    unique_by_key(execution_policy<DerivedPolicy> &exec,
+                  ForwardIterator1 keys_first, 
+                  ForwardIterator1 keys_last,
+                  ForwardIterator2 values_first,
+                  BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator1>::type traversal1;
+  typedef typename thrust::iterator_traversal<ForwardIterator2>::type traversal2;
+
+  typedef typename thrust::detail::minimum_type<traversal1,traversal2>::type traversal;
+
+  return thrust::system::omp::detail::unique_by_key_detail::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred, traversal());
+} // end unique_by_key()
+
+
 template<typename DerivedPolicy,
          typename InputIterator1,
          typename InputIterator2,
@@ -62,8 +181,10 @@ template<typename DerivedPolicy,
                        OutputIterator2 values_output,
                        BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
-  return thrust::system::detail::generic::unique_by_key_copy(exec,keys_first,keys_last,values_first,keys_output,values_output,binary_pred);
+  typedef typename thrust::iterator_value<InputIterator2>::type ValueType;
+
+  // keeping the first value of each segment is a reduction which ignores its right operand
+  return thrust::system::omp::detail::reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, thrust::project1st<ValueType,ValueType>());
 } // end unique_by_key_copy()
 
 
@@ -45,6 +45,12 @@ template<typename T, typename Allocator>
       : super_t(n,value)
 {}
 
+template<typename T, typename Allocator>
+  vector<T,Allocator>
+    ::vector(size_type n, no_init_t)
+      : super_t(n,no_init)
+{}
+
 template<typename T, typename Allocator>
   vector<T,Allocator>
     ::vector(const vector &x)
@@ -25,7 +25,13 @@
 #include <thrust/memory.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/detail/allocator/malloc_allocator.h>
+#include <thrust/detail/allocator/aligned_allocator.h>
+#include <thrust/detail/allocator/page_locked_allocator.h>
+#include <thrust/detail/allocator/caching_allocator.h>
+#include <thrust/detail/allocator/arena.h>
+#include <thrust/detail/allocator/allocation_profiler.h>
 #include <ostream>
+#include <new>
 
 namespace thrust
 {
@@ -387,6 +393,353 @@ template<typename T>
   inline ~allocator() {}
 }; // end allocator
 
+
+/*! \p omp::aligned_allocator allocates storage for the \p omp system aligned to
+ *  \p Alignment bytes, which must be a power of two. The default of 64 bytes
+ *  places the first element of a container on a cache line boundary, so that
+ *  vectorized loops do not begin with a misaligned head.
+ *
+ *  \code
+ *  #include <thrust/system/omp/vector.h>
+ *  ...
+ *  thrust::omp::vector<float, thrust::omp::aligned_allocator<float> > v(n);
+ *  \endcode
+ *
+ *  \see huge_page_allocator
+ */
+template<typename T, std::size_t Alignment = 64>
+  struct aligned_allocator
+    : thrust::detail::aligned_allocator<
+        T,
+        tag,
+        pointer<T>,
+        Alignment
+      >
+{
+  /*! The \p rebind metafunction provides the type of an \p aligned_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p aligned_allocator.
+     */
+    typedef aligned_allocator<U,Alignment> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  inline aligned_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  inline aligned_allocator(const aligned_allocator &) {}
+
+  /*! Constructor from other \p aligned_allocator has no effect.
+   */
+  template<typename U>
+  inline aligned_allocator(const aligned_allocator<U,Alignment> &) {}
+}; // end aligned_allocator
+
+
+/*! \p omp::huge_page_allocator allocates storage for the \p omp system aligned
+ *  to 2 MB and, on Linux, advises the kernel to back them with transparent
+ *  huge pages. For arrays of many megabytes this removes most TLB misses from
+ *  bandwidth-bound algorithms such as \p reduce and \p transform. Blocks
+ *  smaller than 2 MB are aligned to 64 bytes instead, so that small
+ *  temporaries do not each occupy a huge page. Where transparent huge pages
+ *  are unavailable it behaves like an \p aligned_allocator with 2 MB alignment.
+ *
+ *  \p huge_page_allocator may also provide the temporary storage of an algorithm:
+ *
+ *  \code
+ *  #include <thrust/system/omp/memory.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::omp::huge_page_allocator<char> alloc;
+ *
+ *  thrust::sort(thrust::omp::par(alloc), keys.begin(), keys.end());
+ *  \endcode
+ */
+template<typename T>
+  struct huge_page_allocator
+    : aligned_allocator<T, std::size_t(2) << 20>
+{
+  /*! The \p rebind metafunction provides the type of a \p huge_page_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p huge_page_allocator.
+     */
+    typedef huge_page_allocator<U> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  inline huge_page_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  inline huge_page_allocator(const huge_page_allocator &) : aligned_allocator<T, std::size_t(2) << 20>() {}
+
+  /*! Constructor from other \p huge_page_allocator has no effect.
+   */
+  template<typename U>
+  inline huge_page_allocator(const huge_page_allocator<U> &) : aligned_allocator<T, std::size_t(2) << 20>() {}
+}; // end huge_page_allocator
+
+
+/*! \p omp::page_locked_allocator allocates storage for the \p omp system
+ *  whose pages are all faulted in when it is allocated and, on Linux, locked
+ *  into memory with \p mlock. All threads of the \p omp system fault in the
+ *  pages in parallel. Algorithms operating on the storage therefore never
+ *  stall on a page fault, which makes the first call on a freshly allocated
+ *  vector as fast as later ones.
+ *
+ *  Locking is best effort: blocks smaller than 16 pages, and blocks which
+ *  would exceed the process's locked memory limit (\c RLIMIT_MEMLOCK), are
+ *  faulted in but not locked. Unlike \p thrust::cuda::experimental::pinned_allocator,
+ *  \p page_locked_allocator does not depend on the CUDA runtime.
+ *
+ *  \code
+ *  #include <thrust/system/omp/memory.h>
+ *  #include <thrust/host_vector.h>
+ *  ...
+ *  thrust::host_vector<float, thrust::omp::page_locked_allocator<float> > v(n);
+ *  \endcode
+ */
+template<typename T>
+  struct page_locked_allocator
+    : thrust::detail::page_locked_allocator<
+        T,
+        tag,
+        pointer<T>
+      >
+{
+  /*! The \p rebind metafunction provides the type of a \p page_locked_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p page_locked_allocator.
+     */
+    typedef page_locked_allocator<U> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  inline page_locked_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  inline page_locked_allocator(const page_locked_allocator &) {}
+
+  /*! Constructor from other \p page_locked_allocator has no effect.
+   */
+  template<typename U>
+  inline page_locked_allocator(const page_locked_allocator<U> &) {}
+}; // end page_locked_allocator
+
+
+/*! \p caching_allocator is a thread-safe allocator of temporary storage for
+ *  the host systems. It keeps deallocated blocks in bins of similar size and
+ *  reuses them for later requests, which avoids the cost of obtaining fresh
+ *  memory from the system on every algorithm invocation.
+ *
+ *  The following code snippet demonstrates how to use \p caching_allocator
+ *  as the source of an algorithm's temporary storage:
+ *
+ *  \code
+ *  #include <thrust/system/omp/memory.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::omp::caching_allocator pool;
+ *
+ *  for(int i = 0; i < 1000; ++i)
+ *  {
+ *    // every iteration after the first reuses the same temporary storage
+ *    thrust::sort_by_key(thrust::omp::par(pool), keys.begin(), keys.end(), values.begin());
+ *  }
+ *
+ *  thrust::omp::caching_allocator_statistics stats = pool.statistics();
+ *  \endcode
+ *
+ *  \see thrust::omp::caching_allocator_statistics
+ */
+typedef thrust::detail::caching_allocator caching_allocator;
+
+
+/*! \p caching_allocator_statistics reports the hits, misses, bytes retained
+ *  and high-water mark of a \p caching_allocator.
+ */
+typedef thrust::detail::caching_allocator_statistics caching_allocator_statistics;
+
+
+/*! \p arena reserves one block of host memory up front and carves the
+ *  temporary storage of the algorithms which use it from that block, so that
+ *  a pipeline of algorithms runs without calling \p malloc. The block is
+ *  freed when the \p arena goes out of scope.
+ *
+ *  The following code snippet demonstrates a pipeline whose temporaries all
+ *  come from one arena:
+ *
+ *  \code
+ *  #include <thrust/system/omp/memory.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <thrust/copy.h>
+ *  #include <thrust/sort.h>
+ *  #include <thrust/reduce.h>
+ *  ...
+ *  thrust::omp::arena scratch(64 << 20);
+ *
+ *  end = thrust::copy_if(thrust::omp::par(scratch), first, last, keys.begin(), pred);
+ *  thrust::sort_by_key(thrust::omp::par(scratch), keys.begin(), end, values.begin());
+ *  thrust::reduce_by_key(thrust::omp::par(scratch), keys.begin(), end, values.begin(),
+ *                        unique_keys.begin(), sums.begin());
+ *
+ *  // size the arena for the next request
+ *  thrust::omp::arena_statistics stats = scratch.statistics();
+ *  assert(stats.overflows == 0);
+ *  \endcode
+ *
+ *  \see thrust::omp::arena_statistics
+ */
+typedef thrust::detail::arena arena;
+
+
+/*! \p arena_statistics reports the bytes in use, high-water mark and
+ *  overflows of an \p arena.
+ */
+typedef thrust::detail::arena_statistics arena_statistics;
+
+
+/*! \p allocation_profiler records the temporary allocations of the algorithms
+ *  which use it: their number, their sizes and the peak number of bytes
+ *  allocated at once.
+ *
+ *  The following code snippet demonstrates how to measure the temporary
+ *  storage of a single algorithm invocation:
+ *
+ *  \code
+ *  #include <thrust/system/omp/memory.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <thrust/sort.h>
+ *  ...
+ *  thrust::omp::allocation_profiler profiler;
+ *
+ *  thrust::sort_by_key(thrust::omp::par(profiler), keys.begin(), keys.end(), values.begin());
+ *
+ *  thrust::omp::allocation_profile profile = profiler.profile();
+ *
+ *  // profile.peak_bytes is the scratch memory sort_by_key needed
+ *
+ *  profiler.reset();
+ *  \endcode
+ *
+ *  \see thrust::omp::allocation_profile
+ */
+typedef thrust::detail::allocation_profiler allocation_profiler;
+
+
+/*! \p allocation_profile reports the number, sizes and peak bytes of the
+ *  allocations recorded by an \p allocation_profiler.
+ */
+typedef thrust::detail::allocation_profile allocation_profile;
+
+
+/*! \p numa_allocator is an allocator for \p omp::vector which places each page
+ *  of the vector's storage on the NUMA node of the thread which later processes
+ *  it. \p allocate obtains fresh, untouched pages and writes one byte of each
+ *  from the thread that owns the page's interval of
+ *  \p default_decomposition, so that the operating system's first-touch
+ *  policy distributes the pages the way the OpenMP backend's algorithms distribute work.
+ *  Elements are then default-, fill- and copy-constructed in parallel.
+ *
+ *  On a machine with a single NUMA node, or one whose operating system does not
+ *  place pages on first touch, \p numa_allocator behaves like \p omp::allocator
+ *  with parallel construction.
+ *
+ *  \code
+ *  #include <thrust/system/omp/vector.h>
+ *  ...
+ *  thrust::omp::vector<float, thrust::omp::numa_allocator<float> > v(n);
+ *  \endcode
+ */
+template<typename T>
+  struct numa_allocator
+    : allocator<T>
+{
+  /*! \cond
+   */
+  typedef allocator<T>                  super_t;
+  typedef typename super_t::pointer     pointer;
+  typedef typename super_t::size_type   size_type;
+  /*! \endcond
+   */
+
+  /*! The \p rebind metafunction provides the type of a \p numa_allocator
+   *  instantiated with another type.
+   *
+   *  \tparam U The other type to use for instantiation.
+   */
+  template<typename U>
+    struct rebind
+  {
+    /*! The typedef \p other gives the type of the rebound \p numa_allocator.
+     */
+    typedef numa_allocator<U> other;
+  };
+
+  /*! No-argument constructor has no effect.
+   */
+  inline numa_allocator() {}
+
+  /*! Copy constructor has no effect.
+   */
+  inline numa_allocator(const numa_allocator &) : super_t() {}
+
+  /*! Constructor from other \p numa_allocator has no effect.
+   */
+  template<typename U>
+  inline numa_allocator(const numa_allocator<U> &) {}
+
+  /*! Allocates storage for \p cnt elements and places its pages.
+   *  \throw bad_alloc if the storage cannot be obtained.
+   */
+  inline pointer allocate(size_type cnt);
+
+  /*! Deallocates storage obtained from \p allocate.
+   */
+  inline void deallocate(pointer p, size_type cnt);
+
+  /*! Default-constructs an element. Its presence makes containers construct
+   *  their elements with a parallel \p for_each.
+   */
+  inline void construct(T *p)
+  {
+    ::new(static_cast<void*>(p)) T();
+  }
+
+  /*! Constructs an element from \p arg.
+   */
+  template<typename Arg1>
+  inline void construct(T *p, const Arg1 &arg)
+  {
+    ::new(static_cast<void*>(p)) T(arg);
+  }
+}; // end numa_allocator
+
 } // end omp
 
 /*! \}
@@ -405,6 +758,16 @@ using thrust::system::omp::reference;
 using thrust::system::omp::malloc;
 using thrust::system::omp::free;
 using thrust::system::omp::allocator;
+using thrust::system::omp::caching_allocator;
+using thrust::system::omp::caching_allocator_statistics;
+using thrust::system::omp::arena;
+using thrust::system::omp::arena_statistics;
+using thrust::system::omp::allocation_profiler;
+using thrust::system::omp::allocation_profile;
+using thrust::system::omp::aligned_allocator;
+using thrust::system::omp::huge_page_allocator;
+using thrust::system::omp::page_locked_allocator;
+using thrust::system::omp::numa_allocator;
 
 } // end omp
 
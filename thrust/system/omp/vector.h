@@ -91,6 +91,12 @@ template<typename T, typename Allocator = allocator<T> >
      */
     explicit vector(size_type n, const value_type &value);
 
+    /*! This constructor creates a \p omp::vector with \p n elements which are
+     *  left uninitialized if their type has a trivial default constructor.
+     *  \param n The size of the \p omp::vector to create.
+     */
+    vector(size_type n, no_init_t);
+
     /*! Copy constructor copies from another \p omp::vector.
      *  \param x The other \p omp::vector to copy.
      */
@@ -0,0 +1,243 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/binary_search.h>
+#include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/generic/scalar/binary_search.h>
+#include <thrust/system/detail/internal/sorted_search.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
+#include <thrust/system/tbb/detail/tuning.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace binary_search_detail
+{
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering,
+         typename BinarySearchFunction>
+struct search_body
+{
+  RandomAccessIterator1 first;
+  RandomAccessIterator1 last;
+  RandomAccessIterator2 values_first;
+  RandomAccessIterator3 output;
+  StrictWeakOrdering comp;
+  BinarySearchFunction func;
+
+  search_body(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 values_first, RandomAccessIterator3 output, StrictWeakOrdering comp, BinarySearchFunction func)
+    : first(first), last(last), values_first(values_first), output(output), comp(comp), func(func)
+  {}
+
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    // func is not const-callable
+    BinarySearchFunction f = func;
+
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      output[i] = f(first, last, values_first[i], comp);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering,
+         typename BinarySearchFunction>
+  search_body<RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,StrictWeakOrdering,BinarySearchFunction>
+    make_search_body(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 values_first, RandomAccessIterator3 output, StrictWeakOrdering comp, BinarySearchFunction func)
+{
+  return search_body<RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,StrictWeakOrdering,BinarySearchFunction>(first, last, values_first, output, comp, func);
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+struct sorted_search_body
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  RandomAccessIterator1 first;
+  Size n;
+  RandomAccessIterator2 values_first;
+  RandomAccessIterator3 output;
+  StrictWeakOrdering comp;
+
+  sorted_search_body(RandomAccessIterator1 first, Size n, RandomAccessIterator2 values_first, RandomAccessIterator3 output, StrictWeakOrdering comp)
+    : first(first), n(n), values_first(values_first), output(output), comp(comp)
+  {}
+
+  template<typename Size2>
+  void operator()(const ::tbb::blocked_range<Size2> &r) const
+  {
+    // locate the first value of the chunk from scratch, then gallop through the rest
+    Size pos = thrust::system::detail::generic::scalar::lower_bound_n(first, n, values_first[r.begin()], comp) - first;
+
+    thrust::system::detail::internal::galloping_sorted_search(first, n, pos,
+                                                              values_first + r.begin(), values_first + r.end(),
+                                                              output + r.begin(),
+                                                              comp);
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename StrictWeakOrdering>
+  sorted_search_body<RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,StrictWeakOrdering>
+    make_sorted_search_body(RandomAccessIterator1 first, typename thrust::iterator_difference<RandomAccessIterator1>::type n, RandomAccessIterator2 values_first, RandomAccessIterator3 output, StrictWeakOrdering comp)
+{
+  return sorted_search_body<RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,StrictWeakOrdering>(first, n, values_first, output, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering,
+         typename BinarySearchFunction>
+OutputIterator binary_search(execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator first,
+                             ForwardIterator last,
+                             InputIterator values_first,
+                             InputIterator values_last,
+                             OutputIterator output,
+                             StrictWeakOrdering comp,
+                             BinarySearchFunction func)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size n = thrust::distance(values_first, values_last);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n, grain_size(exec)), make_search_body(first, last, values_first, output, comp, func));
+
+  return output + n;
+}
+
+
+} // end namespace binary_search_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator lower_bound(execution_policy<DerivedPolicy> &exec,
+                           ForwardIterator first,
+                           ForwardIterator last,
+                           InputIterator values_first,
+                           InputIterator values_last,
+                           OutputIterator output,
+                           StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search(exec, first, last, values_first, values_last, output, comp, thrust::system::detail::generic::detail::lbf());
+} // end lower_bound()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator upper_bound(execution_policy<DerivedPolicy> &exec,
+                           ForwardIterator first,
+                           ForwardIterator last,
+                           InputIterator values_first,
+                           InputIterator values_last,
+                           OutputIterator output,
+                           StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search(exec, first, last, values_first, values_last, output, comp, thrust::system::detail::generic::detail::ubf());
+} // end upper_bound()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator binary_search(execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator first,
+                             ForwardIterator last,
+                             InputIterator values_first,
+                             InputIterator values_last,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+  return binary_search_detail::binary_search(exec, first, last, values_first, values_last, output, comp, thrust::system::detail::generic::detail::bsf());
+} // end binary_search()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator sorted_search(execution_policy<DerivedPolicy> &exec,
+                             ForwardIterator first,
+                             ForwardIterator last,
+                             InputIterator values_first,
+                             InputIterator values_last,
+                             OutputIterator output,
+                             StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size num_values = thrust::distance(values_first, values_last);
+
+  // each chunk of values pays for one full binary search, so keep chunks large
+  // enough that the galloping searches dominate
+  const std::size_t requested = requested_grain_size(exec);
+
+  const Size grain = requested ? static_cast<Size>(requested) : Size(1024);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_values, grain),
+                      binary_search_detail::make_sorted_search_body(first, thrust::distance(first, last), values_first, output, comp));
+
+  return output + num_values;
+} // end sorted_search()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
@@ -22,6 +22,13 @@
 #include <thrust/system/detail/sequential/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/detail/copy.h>
+#include <thrust/system/detail/sequential/trivial_copy.h>
+#include <thrust/system/tbb/detail/tuning.h>
+#include <thrust/detail/dispatch/is_trivial_copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <cstddef>
 
 namespace thrust
 {
@@ -31,6 +38,85 @@ namespace tbb
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+template<typename T>
+  struct trivial_copy_body
+{
+  const T *m_first;
+  T *m_result;
+
+  trivial_copy_body(const T *first, T *result)
+    : m_first(first), m_result(result)
+  {}
+
+  void operator()(const ::tbb::blocked_range<std::ptrdiff_t> &r) const
+  {
+    thrust::system::detail::sequential::trivial_copy_n(m_first + r.begin(), r.size(), m_result + r.begin());
+  }
+};
+
+
+template<typename T>
+  trivial_copy_body<T> make_trivial_copy_body(const T *first, T *result)
+{
+  return trivial_copy_body<T>(first, result);
+}
+
+
+// copies plain old data with one memmove per task
+template<typename DerivedPolicy, typename T>
+  T *trivial_copy_n(execution_policy<DerivedPolicy> &exec, const T *first, std::ptrdiff_t n, T *result)
+{
+  const std::ptrdiff_t grain = copy_grain_size(exec, sizeof(T));
+
+  // overlapping ranges must be moved as a whole
+  if(n <= grain || (result < first + n && first < result + n))
+  {
+    return thrust::system::detail::sequential::trivial_copy_n(first, n, result);
+  } // end if
+
+  ::tbb::parallel_for(::tbb::blocked_range<std::ptrdiff_t>(0, n, grain), make_trivial_copy_body(first, result));
+
+  return result + n;
+} // end trivial_copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::true_type) // is_trivial_copy
+{
+  copy_detail::trivial_copy_n(exec, thrust::raw_pointer_cast(&*first), n, thrust::raw_pointer_cast(&*result));
+
+  return result + n;
+} // end copy_n()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result,
+                        thrust::detail::false_type) // is_trivial_copy
+{
+  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+} // end copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -57,7 +143,8 @@ template<typename DerivedPolicy,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return thrust::system::tbb::detail::copy_detail::copy_n(exec, first, last - first, result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
 } // end copy()
 
 
@@ -85,7 +172,8 @@ template<typename DerivedPolicy,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return thrust::system::tbb::detail::copy_detail::copy_n(exec, first, n, result,
+    typename thrust::detail::dispatch::is_trivial_copy<InputIterator,OutputIterator>::type());
 } // end copy_n()
 
 
@@ -0,0 +1,240 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/extrema.h>
+#include <thrust/system/detail/generic/extrema.h>
+#include <thrust/system/detail/internal/extrema.h>
+#include <thrust/system/tbb/detail/tuning.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/minmax.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace extrema_detail
+{
+
+
+template<bool FindMin, bool FindMax, typename T, typename Size>
+struct fused_extrema_body
+{
+  typedef thrust::system::detail::internal::extrema_detail::extrema<T,Size> extrema_type;
+
+  const T *data;
+  extrema_type result;
+  bool empty;
+
+  fused_extrema_body(const T *data)
+    : data(data), empty(true)
+  {}
+
+  fused_extrema_body(fused_extrema_body &b, ::tbb::split)
+    : data(b.data), empty(true)
+  {}
+
+  // TBB invokes operator() on consecutive ranges, and joins each body with the
+  // body of the range which follows it, so merging in this order lets the
+  // first occurrence win ties
+  void operator()(const ::tbb::blocked_range<Size> &r)
+  {
+    if(r.empty()) return;
+
+    accumulate(thrust::system::detail::internal::extrema_detail::tile_extrema<FindMin,FindMax>(data, r.begin(), r.end()));
+  }
+
+  void join(fused_extrema_body &b)
+  {
+    if(!b.empty)
+    {
+      accumulate(b.result);
+    }
+  }
+
+  void accumulate(const extrema_type &next)
+  {
+    if(empty)
+    {
+      result = next;
+      empty  = false;
+    }
+    else
+    {
+      thrust::system::detail::internal::extrema_detail::merge_extrema<FindMin,FindMax>(result, next);
+    }
+  }
+}; // end fused_extrema_body
+
+
+// finds the extrema of data[0, n), n > 0, with one pass over each task's range
+template<bool FindMin, bool FindMax, typename DerivedPolicy, typename T, typename Size>
+thrust::system::detail::internal::extrema_detail::extrema<T,Size>
+  fused_extrema(execution_policy<DerivedPolicy> &exec,
+                const T *data,
+                Size n)
+{
+  namespace internal = thrust::system::detail::internal::extrema_detail;
+
+  // a task scans at least a whole block
+  const Size grain = thrust::max<std::size_t>(grain_size(exec), internal::block_size);
+
+  if(n <= grain)
+  {
+    return internal::tile_extrema<FindMin,FindMax>(data, Size(0), n);
+  }
+
+  fused_extrema_body<FindMin,FindMax,T,Size> body(data);
+
+  ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n, grain), body);
+
+  return body.result;
+} // end fused_extrema()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate,
+                            thrust::detail::true_type) // use_fused_extrema
+{
+  if(first == last) return last;
+
+  return first + fused_extrema<false,true>(exec, thrust::raw_pointer_cast(&*first), last - first).max_index;
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::false_type) // use_fused_extrema
+{
+  // tbb prefers generic::max_element to cpp::max_element
+  return thrust::system::detail::generic::max_element(exec, first, last, comp);
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate,
+                            thrust::detail::true_type) // use_fused_extrema
+{
+  if(first == last) return last;
+
+  return first + fused_extrema<true,false>(exec, thrust::raw_pointer_cast(&*first), last - first).min_index;
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp,
+                            thrust::detail::false_type) // use_fused_extrema
+{
+  // tbb prefers generic::min_element to cpp::min_element
+  return thrust::system::detail::generic::min_element(exec, first, last, comp);
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first, 
+                                                             ForwardIterator last,
+                                                             BinaryPredicate,
+                                                             thrust::detail::true_type) // use_fused_extrema
+{
+  if(first == last) return thrust::make_pair(last, last);
+
+  thrust::system::detail::internal::extrema_detail::extrema<
+    typename thrust::iterator_value<ForwardIterator>::type,
+    typename thrust::iterator_difference<ForwardIterator>::type
+  > result = fused_extrema<true,true>(exec, thrust::raw_pointer_cast(&*first), last - first);
+
+  return thrust::make_pair(first + result.min_index, first + result.max_index);
+} // end minmax_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first, 
+                                                             ForwardIterator last,
+                                                             BinaryPredicate comp,
+                                                             thrust::detail::false_type) // use_fused_extrema
+{
+  // tbb prefers generic::minmax_element to cpp::minmax_element
+  return thrust::system::detail::generic::minmax_element(exec, first, last, comp);
+} // end minmax_element()
+
+
+} // end extrema_detail
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator max_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp)
+{
+  return extrema_detail::max_element(exec, first, last, comp,
+    typename thrust::system::detail::internal::extrema_detail::use_fused_extrema<ForwardIterator,BinaryPredicate>::type());
+} // end max_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator min_element(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first, 
+                            ForwardIterator last,
+                            BinaryPredicate comp)
+{
+  return extrema_detail::min_element(exec, first, last, comp,
+    typename thrust::system::detail::internal::extrema_detail::use_fused_extrema<ForwardIterator,BinaryPredicate>::type());
+} // end min_element()
+
+
+template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
+thrust::pair<ForwardIterator,ForwardIterator> minmax_element(execution_policy<DerivedPolicy> &exec,
+                                                             ForwardIterator first, 
+                                                             ForwardIterator last,
+                                                             BinaryPredicate comp)
+{
+  return extrema_detail::minmax_element(exec, first, last, comp,
+    typename thrust::system::detail::internal::extrema_detail::use_fused_extrema<ForwardIterator,BinaryPredicate>::type());
+} // end minmax_element()
+
+
+} // end detail
+} // end tbb
+} // end system
+} // end thrust
+
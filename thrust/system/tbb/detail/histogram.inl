@@ -0,0 +1,228 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/histogram.h>
+#include <thrust/system/detail/sequential/histogram.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/histogram.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/minmax.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/tbb_thread.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace histogram_detail
+{
+
+
+template<typename RandomAccessIterator, typename BinFunction, typename CounterType, typename Decomposition>
+struct count_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator first;
+  BinFunction bin;
+  CounterType *counts;
+  Decomposition decomp;
+
+  count_body(RandomAccessIterator first, BinFunction bin, CounterType *counts, Decomposition decomp)
+    : first(first), bin(bin), counts(counts), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      thrust::system::detail::sequential::histogram_detail::count_bins(first + decomp[t].begin(), first + decomp[t].end(), counts + t * bin.num_bins, bin);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename BinFunction, typename CounterType, typename Decomposition>
+  count_body<RandomAccessIterator,BinFunction,CounterType,Decomposition>
+    make_count_body(RandomAccessIterator first, BinFunction bin, CounterType *counts, Decomposition decomp)
+{
+  return count_body<RandomAccessIterator,BinFunction,CounterType,Decomposition>(first, bin, counts, decomp);
+}
+
+
+template<typename CounterType, typename Size1, typename Size2, typename RandomAccessIterator>
+struct sum_body
+{
+  const CounterType *counts;
+  Size1 num_bins;
+  Size2 num_tiles;
+  RandomAccessIterator histogram;
+
+  sum_body(const CounterType *counts, Size1 num_bins, Size2 num_tiles, RandomAccessIterator histogram)
+    : counts(counts), num_bins(num_bins), num_tiles(num_tiles), histogram(histogram)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size1> &r) const
+  {
+    for(Size1 b = r.begin(); b != r.end(); ++b)
+    {
+      CounterType sum = counts[b];
+
+      for(Size2 t = 1; t < num_tiles; ++t)
+      {
+        sum += counts[t * num_bins + b];
+      }
+
+      histogram[b] = sum;
+    }
+  }
+};
+
+
+template<typename CounterType, typename Size1, typename Size2, typename RandomAccessIterator>
+  sum_body<CounterType,Size1,Size2,RandomAccessIterator>
+    make_sum_body(const CounterType *counts, Size1 num_bins, Size2 num_tiles, RandomAccessIterator histogram)
+{
+  return sum_body<CounterType,Size1,Size2,RandomAccessIterator>(counts, num_bins, num_tiles, histogram);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+RandomAccessIterator privatized_histogram(execution_policy<DerivedPolicy> &,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          RandomAccessIterator histogram,
+                                          BinFunction bin,
+                                          thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::sequential::histogram_detail::count_bins(first, last, histogram, bin);
+}
+
+
+// every tile counts its samples into bins of its own, and the tiles' bins
+// are summed into the histogram
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename BinFunction>
+RandomAccessIterator privatized_histogram(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator first,
+                                          InputIterator last,
+                                          RandomAccessIterator histogram,
+                                          BinFunction bin,
+                                          thrust::random_access_traversal_tag)
+{
+  typedef typename BinFunction::result_type                           Size;
+  typedef typename thrust::iterator_difference<InputIterator>::type   Difference;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type counter_type;
+
+  const Difference n = last - first;
+  const Size num_bins = bin.num_bins;
+
+  // one tile per processor, each of which counts at least num_bins samples
+  // so that the tiles' bins take no more storage than the samples
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Difference> Decomposition;
+  Decomposition decomp(n, static_cast<Difference>(num_bins), p);
+
+  const Difference num_tiles = decomp.size();
+
+  if(num_tiles <= 1)
+  {
+    return thrust::system::detail::sequential::histogram_detail::count_bins(first, last, histogram, bin);
+  }
+
+  thrust::detail::temporary_array<counter_type,DerivedPolicy> counts_storage(exec, num_tiles * num_bins);
+  counter_type *counts = thrust::raw_pointer_cast(&*counts_storage.begin());
+
+  ::tbb::parallel_for(::tbb::blocked_range<Difference>(0, num_tiles, 1), make_count_body(first, bin, counts, decomp), ::tbb::simple_partitioner());
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_bins), make_sum_body(counts, num_bins, num_tiles, histogram));
+
+  return histogram + num_bins;
+}
+
+
+} // end namespace histogram_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename Size,
+         typename T>
+RandomAccessIterator histogram_even(execution_policy<DerivedPolicy> &exec,
+                                    InputIterator first,
+                                    InputIterator last,
+                                    RandomAccessIterator histogram,
+                                    Size num_bins,
+                                    T lower_level,
+                                    T upper_level)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  if(num_bins <= 0) return histogram;
+
+  typedef typename thrust::iterator_traversal<InputIterator>::type traversal;
+
+  return histogram_detail::privatized_histogram(exec, first, last, histogram, internal::even_bin<T,Size>(lower_level, upper_level, num_bins), traversal());
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+RandomAccessIterator2 histogram_range(execution_policy<DerivedPolicy> &exec,
+                                      InputIterator first,
+                                      InputIterator last,
+                                      RandomAccessIterator1 levels_first,
+                                      RandomAccessIterator1 levels_last,
+                                      RandomAccessIterator2 histogram)
+{
+  namespace internal = thrust::system::detail::internal::histogram_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size num_bins = (levels_last - levels_first) - 1;
+
+  if(num_bins <= 0) return histogram;
+
+  typedef typename thrust::iterator_traversal<InputIterator>::type traversal;
+
+  return histogram_detail::privatized_histogram(exec, first, last, histogram, internal::range_bin<RandomAccessIterator1,Size>(levels_first, num_bins), traversal());
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
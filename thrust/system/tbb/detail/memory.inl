@@ -18,7 +18,15 @@
 #include <thrust/system/cpp/detail/execution_policy.h>
 #include <thrust/system/tbb/memory.h>
 #include <thrust/system/cpp/memory.h>
+#include <thrust/system/detail/internal/first_touch.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/detail/minmax.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/tbb_thread.h>
 #include <limits>
+#include <new>
 
 namespace thrust
 {
@@ -104,6 +112,78 @@ inline void free(pointer<void> ptr)
   detail::free_workaround(cpp::tag(), ptr);
 } // end free()
 
+
+namespace detail
+{
+
+
+template<typename T>
+  struct touch_body
+{
+  typedef std::ptrdiff_t index_type;
+
+  char *storage;
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp;
+
+  touch_body(char *storage, const thrust::system::detail::internal::uniform_decomposition<index_type> &decomp)
+    : storage(storage), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::index_range<index_type> range = decomp[i];
+
+      thrust::system::detail::internal::touch_pages(storage + range.begin() * sizeof(T),
+                                                    storage + range.end()   * sizeof(T));
+    }
+  }
+}; // end touch_body
+
+
+} // end detail
+
+
+template<typename T>
+  typename numa_allocator<T>::pointer
+    numa_allocator<T>
+      ::allocate(size_type cnt)
+{
+  if(cnt > this->max_size())
+  {
+    throw std::bad_alloc();
+  } // end if
+
+  char *result = static_cast<char*>(thrust::system::detail::internal::allocate_untouched(cnt * sizeof(T)));
+
+  if(result == 0 && cnt > 0)
+  {
+    throw std::bad_alloc();
+  } // end if
+
+  typedef std::ptrdiff_t index_type;
+
+  // one interval per hardware thread, each touched by a single task
+  index_type num_threads = thrust::max<index_type>(1, ::tbb::tbb_thread::hardware_concurrency());
+
+  thrust::system::detail::internal::uniform_decomposition<index_type> decomp(cnt, 1, num_threads);
+
+  ::tbb::parallel_for(::tbb::blocked_range<index_type>(0, decomp.size(), 1),
+                      detail::touch_body<T>(result, decomp),
+                      ::tbb::simple_partitioner());
+
+  return pointer(reinterpret_cast<T*>(result));
+} // end numa_allocator::allocate()
+
+
+template<typename T>
+  void numa_allocator<T>
+    ::deallocate(pointer p, size_type cnt)
+{
+  thrust::system::detail::internal::deallocate_untouched(thrust::raw_pointer_cast(p), cnt * sizeof(T));
+} // end numa_allocator::deallocate()
+
 } // end tbb
 } // end system
 } // end thrust
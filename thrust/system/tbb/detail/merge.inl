@@ -17,6 +17,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 #include <thrust/merge.h>
 #include <thrust/binary_search.h>
 #include <thrust/detail/seq.h>
@@ -49,7 +50,7 @@ struct range
         InputIterator2 first2, InputIterator2 last2,
         OutputIterator result,
         StrictWeakOrdering comp,
-        size_t grain_size = 1024)
+        size_t grain_size)
     : first1(first1), last1(last1),
       first2(first2), last2(last2),
       result(result), comp(comp), grain_size(grain_size)
@@ -142,7 +143,7 @@ struct range
         OutputIterator1 keys_result,
         OutputIterator2 values_result,
         StrictWeakOrdering comp,
-        size_t grain_size = 1024)
+        size_t grain_size)
     : keys_first1(keys_first1), keys_last1(keys_last1),
       keys_first2(keys_first2), keys_last2(keys_last2),
       values_first1(values_first1),
@@ -235,7 +236,9 @@ OutputIterator merge(execution_policy<DerivedPolicy> &exec,
 {
   typedef typename merge_detail::range<InputIterator1,InputIterator2,OutputIterator,StrictWeakOrdering> Range;
   typedef          merge_detail::body                                                                   Body;
-  Range range(first1, last1, first2, last2, result, comp);
+  typedef typename thrust::iterator_value<InputIterator1>::type                                          value_type;
+
+  Range range(first1, last1, first2, last2, result, comp, merge_grain_size(exec, sizeof(value_type)));
   Body  body;
 
   ::tbb::parallel_for(range, body);
@@ -268,7 +271,11 @@ thrust::pair<OutputIterator1,OutputIterator2>
   typedef typename merge_by_key_detail::range<InputIterator1,InputIterator2,InputIterator3,InputIterator4,OutputIterator1,OutputIterator2,StrictWeakOrdering> Range;
   typedef          merge_by_key_detail::body                                                                                                                  Body;
 
-  Range range(keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
+  typedef typename thrust::iterator_value<InputIterator1>::type key_type;
+  typedef typename thrust::iterator_value<InputIterator3>::type value_type;
+
+  Range range(keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp,
+              merge_grain_size(exec, sizeof(key_type) + sizeof(value_type)));
   Body  body;
 
   ::tbb::parallel_for(range, body);
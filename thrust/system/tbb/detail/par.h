@@ -19,6 +19,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/detail/execute_with_allocator.h>
+#include <cstddef>
 
 namespace thrust
 {
@@ -30,10 +31,59 @@ namespace detail
 {
 
 
+// an execution policy which overrides the backend's tuned grain size
+// see tuning.h for how each algorithm interprets the grain size
+struct execute_with_grain : thrust::system::tbb::detail::execution_policy<execute_with_grain>
+{
+  std::size_t m_grain_size;
+  std::size_t m_merge_grain_size;
+
+  explicit execute_with_grain(std::size_t grain_size, std::size_t merge_grain_size = 0)
+    : thrust::system::tbb::detail::execution_policy<execute_with_grain>(),
+      m_grain_size(grain_size),
+      m_merge_grain_size(merge_grain_size)
+  {}
+
+  // split merges, including those of merge sort, no further than merge_grain_size
+  // elements, independently of the grain size of other algorithms
+  execute_with_grain merge_grain(std::size_t merge_grain_size) const
+  {
+    return execute_with_grain(m_grain_size, merge_grain_size);
+  }
+};
+
+
+// an execution policy which selects the memory-frugal variants of algorithms
+// which otherwise allocate temporary storage as large as their input
+// see sort.inl for how the scratch fraction is interpreted
+struct execute_with_bounded_memory : thrust::system::tbb::detail::execution_policy<execute_with_bounded_memory>
+{
+  double m_scratch_fraction;
+
+  explicit execute_with_bounded_memory(double scratch_fraction)
+    : thrust::system::tbb::detail::execution_policy<execute_with_bounded_memory>(),
+      m_scratch_fraction(scratch_fraction)
+  {}
+};
+
+
 struct par_t : thrust::system::tbb::detail::execution_policy<par_t>
 {
   par_t() : thrust::system::tbb::detail::execution_policy<par_t>() {}
 
+  // process at least grain_size elements per task
+  // a grain_size of zero selects the tuned default
+  execute_with_grain grain(std::size_t grain_size) const
+  {
+    return execute_with_grain(grain_size);
+  }
+
+  // sort with at most scratch_fraction * n elements of temporary storage
+  execute_with_bounded_memory bounded_memory(double scratch_fraction = 1.0 / 16) const
+  {
+    return execute_with_bounded_memory(scratch_fraction);
+  }
+
   template<typename Allocator>
     thrust::detail::execute_with_allocator<Allocator, thrust::system::tbb::detail::execution_policy>
       operator()(Allocator &alloc) const
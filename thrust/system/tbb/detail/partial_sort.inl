@@ -0,0 +1,473 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/partial_sort.h>
+#include <thrust/system/detail/generic/partial_sort.h>
+#include <thrust/system/detail/sequential/partial_sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/selection.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/pair.h>
+#include <thrust/copy.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/tbb_thread.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace partial_sort_detail
+{
+
+
+template<typename Encoder, typename RandomAccessIterator, typename Decomposition>
+struct histogram_candidates_body
+{
+  typedef typename Decomposition::index_type Size;
+  typedef typename Encoder::encoded_type     encoded_type;
+
+  RandomAccessIterator keys;
+  Decomposition decomp;
+  unsigned int pass;
+  encoded_type prefix;
+  size_t *histograms;
+
+  histogram_candidates_body(RandomAccessIterator keys, Decomposition decomp, unsigned int pass, encoded_type prefix, size_t *histograms)
+    : keys(keys), decomp(decomp), pass(pass), prefix(prefix), histograms(histograms)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace radix     = thrust::system::detail::internal::radix_sort_detail;
+    namespace selection = thrust::system::detail::internal::selection_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      selection::histogram_candidates_tile<Encoder>(keys, decomp[t].begin(), decomp[t].end(), pass, prefix, histograms + t * radix::radix_size);
+    }
+  }
+};
+
+
+template<typename Encoder, typename RandomAccessIterator, typename Decomposition>
+  histogram_candidates_body<Encoder,RandomAccessIterator,Decomposition>
+    make_histogram_candidates_body(RandomAccessIterator keys, Decomposition decomp, unsigned int pass, typename Encoder::encoded_type prefix, size_t *histograms)
+{
+  return histogram_candidates_body<Encoder,RandomAccessIterator,Decomposition>(keys, decomp, pass, prefix, histograms);
+}
+
+
+template<typename RandomAccessIterator, typename Classifier, typename Decomposition>
+struct count_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator first;
+  Classifier classify;
+  Decomposition decomp;
+  size_t *counts;
+
+  count_body(RandomAccessIterator first, Classifier classify, Decomposition decomp, size_t *counts)
+    : first(first), classify(classify), decomp(decomp), counts(counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace selection = thrust::system::detail::internal::selection_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      selection::count_tile(first, decomp[t].begin(), decomp[t].end(), classify, counts + 3 * t);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename Classifier, typename Decomposition>
+  count_body<RandomAccessIterator,Classifier,Decomposition>
+    make_count_body(RandomAccessIterator first, Classifier classify, Decomposition decomp, size_t *counts)
+{
+  return count_body<RandomAccessIterator,Classifier,Decomposition>(first, classify, decomp, counts);
+}
+
+
+template<typename RandomAccessIterator1, typename Classifier, typename RandomAccessIterator2, typename Decomposition>
+struct scatter_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator1 first;
+  Classifier classify;
+  RandomAccessIterator2 result;
+  Decomposition decomp;
+  size_t *offsets;
+
+  scatter_body(RandomAccessIterator1 first, Classifier classify, RandomAccessIterator2 result, Decomposition decomp, size_t *offsets)
+    : first(first), classify(classify), result(result), decomp(decomp), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace selection = thrust::system::detail::internal::selection_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      selection::scatter_tile(first, decomp[t].begin(), decomp[t].end(), classify, result, offsets + 3 * t);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1, typename Classifier, typename RandomAccessIterator2, typename Decomposition>
+  scatter_body<RandomAccessIterator1,Classifier,RandomAccessIterator2,Decomposition>
+    make_scatter_body(RandomAccessIterator1 first, Classifier classify, RandomAccessIterator2 result, Decomposition decomp, size_t *offsets)
+{
+  return scatter_body<RandomAccessIterator1,Classifier,RandomAccessIterator2,Decomposition>(first, classify, result, decomp, offsets);
+}
+
+
+template<typename RandomAccessIterator, typename T, typename Compare, typename Decomposition>
+struct heap_select_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator first;
+  T *candidates;
+  Size m;
+  Compare comp;
+  Decomposition decomp;
+
+  heap_select_body(RandomAccessIterator first, T *candidates, Size m, Compare comp, Decomposition decomp)
+    : first(first), candidates(candidates), m(m), comp(comp), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace selection = thrust::system::detail::internal::selection_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      selection::heap_select_tile(first, decomp[t].begin(), decomp[t].end(), candidates + t * m, m, comp);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename T, typename Compare, typename Decomposition>
+  heap_select_body<RandomAccessIterator,T,Compare,Decomposition>
+    make_heap_select_body(RandomAccessIterator first, T *candidates, typename Decomposition::index_type m, Compare comp, Decomposition decomp)
+{
+  return heap_select_body<RandomAccessIterator,T,Compare,Decomposition>(first, candidates, m, comp, decomp);
+}
+
+
+// one tile per processor
+template<typename Size>
+thrust::system::detail::internal::uniform_decomposition<Size> tile_decomposition(Size n)
+{
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  return thrust::system::detail::internal::uniform_decomposition<Size>(n, 1, p);
+}
+
+
+// rearranges first[0, n) into the elements which classify places before,
+// with and after its pivot, using temp[0, n) as scratch space.
+// returns the number of elements before and with the pivot
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename Size,
+         typename Classifier,
+         typename RandomAccessIterator2>
+thrust::pair<Size,Size> partition_about_pivot(execution_policy<DerivedPolicy> &exec,
+                                              RandomAccessIterator1 first,
+                                              Size n,
+                                              Classifier classify,
+                                              RandomAccessIterator2 temp)
+{
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp = tile_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<size_t,DerivedPolicy> counts_storage(exec, 3 * num_tiles);
+  size_t *counts = thrust::raw_pointer_cast(&*counts_storage.begin());
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_count_body(first, classify, decomp, counts), ::tbb::simple_partitioner());
+
+  size_t num_before = 0;
+  size_t num_equivalent = 0;
+
+  selection::scan_tile_counts(counts, num_tiles, num_before, num_equivalent);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_scatter_body(first, classify, temp, decomp, counts), ::tbb::simple_partitioner());
+
+  thrust::copy(exec, temp, temp + n, first);
+
+  return thrust::make_pair(Size(num_before), Size(num_equivalent));
+}
+
+
+// radix select: finds the encoding of the nth key one digit at a time from
+// the histograms of the keys which agree with it so far, then partitions
+// about it once
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering,
+                 thrust::detail::true_type) // use_radix_select
+{
+  namespace radix     = thrust::system::detail::internal::radix_sort_detail;
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  typedef selection::radix_select_encoder<KeyType,StrictWeakOrdering> Encoder;
+  typedef typename Encoder::encoded_type                              encoded_type;
+
+  const Size n = last - first;
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp = tile_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  // one histogram per tile, reused by every pass
+  thrust::detail::temporary_array<size_t,DerivedPolicy> histograms_storage(exec, num_tiles * radix::radix_size);
+  size_t *histograms = thrust::raw_pointer_cast(&*histograms_storage.begin());
+
+  size_t rank = nth - first;
+  encoded_type pivot = 0;
+
+  for(unsigned int pass = 0; pass < Encoder::num_passes; ++pass)
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_histogram_candidates_body<Encoder>(first, decomp, pass, pivot, histograms), ::tbb::simple_partitioner());
+
+    const unsigned int d = selection::select_digit(histograms, num_tiles, rank);
+
+    pivot |= static_cast<encoded_type>(d) << (Encoder::num_bits - radix::radix_bits * (pass + 1));
+  }
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> temp(exec, n);
+
+  partition_about_pivot(exec, first, n, selection::radix_classifier<Encoder>(pivot), temp.begin());
+}
+
+
+// sample select: partitions about a sampled pivot and keeps the side which
+// holds nth until it is short enough to finish sequentially
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type) // use_radix_select
+{
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  thrust::detail::temporary_array<value_type,DerivedPolicy> temp(exec, last - first);
+
+  const Size rank = nth - first;
+
+  Size lo = 0;
+  Size hi = last - first;
+
+  while(static_cast<size_t>(hi - lo) >= selection::sequential_cutoff)
+  {
+    const Size n = hi - lo;
+
+    value_type pivot = first[lo + selection::sample_pivot(first + lo, n, rank - lo, comp)];
+
+    thrust::pair<Size,Size> counts =
+      partition_about_pivot(exec, first + lo, n, selection::comparison_classifier<value_type,StrictWeakOrdering>(pivot, comp), temp.begin());
+
+    const Size before = lo + counts.first;
+    const Size after  = before + counts.second;
+
+    if(rank < before)
+    {
+      hi = before;
+    }
+    else if(rank < after)
+    {
+      // nth is equivalent to the pivot
+      return;
+    }
+    else
+    {
+      lo = after;
+    }
+  }
+
+  thrust::system::detail::sequential::nth_element(exec, first + lo, nth, first + hi, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator first,
+                                       InputIterator last,
+                                       RandomAccessIterator result_first,
+                                       RandomAccessIterator result_last,
+                                       StrictWeakOrdering comp,
+                                       thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator first,
+                                       InputIterator last,
+                                       RandomAccessIterator result_first,
+                                       RandomAccessIterator result_last,
+                                       StrictWeakOrdering comp,
+                                       thrust::random_access_traversal_tag)
+{
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  typedef typename thrust::iterator_value<InputIterator>::type      value_type;
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+
+  const Size n = last - first;
+  const Size m = thrust::min<Size>(n, result_last - result_first);
+
+  if(static_cast<size_t>(n) < selection::sequential_cutoff)
+  {
+    return thrust::system::detail::sequential::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+  }
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp = tile_decomposition(n);
+
+  const Size num_tiles = decomp.size();
+
+  // unless m is small relative to a tile, select from a copy of the input
+  if(m == 0 || 8 * m > n / num_tiles)
+  {
+    return thrust::system::detail::generic::partial_sort_copy(exec, first, last, result_first, result_last, comp);
+  }
+
+  // every tile keeps a heap of its m first elements in a single pass, and
+  // the result is selected from the union of the heaps
+  thrust::detail::temporary_array<value_type,DerivedPolicy> candidates(exec, num_tiles * m);
+
+  // the heaps compare elements in place, so address them through raw pointers
+  value_type *candidates_ptr = thrust::raw_pointer_cast(&*candidates.begin());
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_heap_select_body(first, candidates_ptr, m, comp, decomp), ::tbb::simple_partitioner());
+
+  return thrust::system::detail::sequential::partial_sort_copy(exec, candidates_ptr, candidates_ptr + num_tiles * m, result_first, result_last, comp);
+}
+
+
+} // end namespace partial_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void nth_element(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator nth,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  namespace selection = thrust::system::detail::internal::selection_detail;
+
+  if(nth == last) return;
+
+  if(static_cast<size_t>(last - first) < selection::sequential_cutoff)
+  {
+    thrust::system::detail::sequential::nth_element(exec, first, nth, last, comp);
+    return;
+  }
+
+  typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
+  selection::use_radix_select<KeyType,StrictWeakOrdering> use_radix_select;
+
+  partial_sort_detail::nth_element(exec, first, nth, last, comp, use_radix_select);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void partial_sort(execution_policy<DerivedPolicy> &exec,
+                  RandomAccessIterator first,
+                  RandomAccessIterator middle,
+                  RandomAccessIterator last,
+                  StrictWeakOrdering comp)
+{
+  // tbb prefers generic::partial_sort to cpp::partial_sort
+  thrust::system::detail::generic::partial_sort(exec, first, middle, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+RandomAccessIterator partial_sort_copy(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator first,
+                                       InputIterator last,
+                                       RandomAccessIterator result_first,
+                                       RandomAccessIterator result_last,
+                                       StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_traversal<InputIterator>::type traversal;
+
+  return partial_sort_detail::partial_sort_copy(exec, first, last, result_first, result_last, comp, traversal());
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
@@ -14,11 +14,25 @@
  *  limitations under the License.
  */
 
+
 #pragma once
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/partition.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/partition.h>
+#include <thrust/system/detail/internal/move_down.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/copy.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/tbb_thread.h>
 
 namespace thrust
 {
@@ -28,6 +42,348 @@ namespace tbb
 {
 namespace detail
 {
+namespace partition_detail
+{
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Predicate, typename Decomposition>
+struct partition_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator1 first;
+  RandomAccessIterator2 stencil;
+  Predicate pred;
+  Decomposition decomp;
+  Size *true_counts;
+
+  partition_body(RandomAccessIterator1 first, RandomAccessIterator2 stencil, Predicate pred, Decomposition decomp, Size *true_counts)
+    : first(first), stencil(stencil), pred(pred), decomp(decomp), true_counts(true_counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace internal = thrust::system::detail::internal::partition_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      true_counts[t] = internal::partition_tile(first, stencil, decomp[t].begin(), decomp[t].end(), pred);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Predicate, typename Decomposition>
+  partition_body<RandomAccessIterator1,RandomAccessIterator2,Predicate,Decomposition>
+    make_partition_body(RandomAccessIterator1 first, RandomAccessIterator2 stencil, Predicate pred, Decomposition decomp, typename Decomposition::index_type *true_counts)
+{
+  return partition_body<RandomAccessIterator1,RandomAccessIterator2,Predicate,Decomposition>(first, stencil, pred, decomp, true_counts);
+}
+
+
+template<typename RandomAccessIterator, typename Decomposition>
+struct swap_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator first;
+  Decomposition decomp;
+  const Size *true_counts;
+  Size num_true;
+  Decomposition swaps;
+
+  swap_body(RandomAccessIterator first, Decomposition decomp, const Size *true_counts, Size num_true, Decomposition swaps)
+    : first(first), decomp(decomp), true_counts(true_counts), num_true(num_true), swaps(swaps)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace internal = thrust::system::detail::internal::partition_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      internal::swap_misplaced(first, decomp, true_counts, num_true, swaps[t].begin(), swaps[t].end());
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename Decomposition>
+  swap_body<RandomAccessIterator,Decomposition>
+    make_swap_body(RandomAccessIterator first, Decomposition decomp, const typename Decomposition::index_type *true_counts, typename Decomposition::index_type num_true, Decomposition swaps)
+{
+  return swap_body<RandomAccessIterator,Decomposition>(first, decomp, true_counts, num_true, swaps);
+}
+
+
+template<typename RandomAccessIterator, typename Predicate, typename Decomposition>
+struct count_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator stencil;
+  Predicate pred;
+  Decomposition decomp;
+  Size *offsets;
+
+  count_body(RandomAccessIterator stencil, Predicate pred, Decomposition decomp, Size *offsets)
+    : stencil(stencil), pred(pred), decomp(decomp), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      Size count = 0;
+
+      for(Size j = decomp[t].begin(); j < decomp[t].end(); ++j)
+      {
+        if(pred(stencil[j]))
+        {
+          ++count;
+        }
+      }
+
+      offsets[t + 1] = count;
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename Predicate, typename Decomposition>
+  count_body<RandomAccessIterator,Predicate,Decomposition>
+    make_count_body(RandomAccessIterator stencil, Predicate pred, Decomposition decomp, typename Decomposition::index_type *offsets)
+{
+  return count_body<RandomAccessIterator,Predicate,Decomposition>(stencil, pred, decomp, offsets);
+}
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename Predicate, typename Decomposition>
+struct stable_partition_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator1 first;
+  RandomAccessIterator2 stencil;
+  T *falses;
+  Predicate pred;
+  Decomposition decomp;
+  const Size *offsets;
+
+  stable_partition_body(RandomAccessIterator1 first, RandomAccessIterator2 stencil, T *falses, Predicate pred, Decomposition decomp, const Size *offsets)
+    : first(first), stencil(stencil), falses(falses), pred(pred), decomp(decomp), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace internal = thrust::system::detail::internal::partition_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      internal::stable_partition_tile(first, stencil, decomp[t].begin(), decomp[t].end(), falses + (decomp[t].begin() - offsets[t]), pred);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename T, typename Predicate, typename Decomposition>
+  stable_partition_body<RandomAccessIterator1,RandomAccessIterator2,T,Predicate,Decomposition>
+    make_stable_partition_body(RandomAccessIterator1 first, RandomAccessIterator2 stencil, T *falses, Predicate pred, Decomposition decomp, const typename Decomposition::index_type *offsets)
+{
+  return stable_partition_body<RandomAccessIterator1,RandomAccessIterator2,T,Predicate,Decomposition>(first, stencil, falses, pred, decomp, offsets);
+}
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            InputIterator stencil,
+                            Predicate pred,
+                            thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::partition(exec, first, last, stencil, pred);
+} // end partition()
+
+
+// each tile is partitioned in place, and the false elements left before the
+// partition point are then swapped with the true elements left after it.
+// neither step needs temporary storage
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Predicate>
+  RandomAccessIterator1 partition(execution_policy<DerivedPolicy> &,
+                                  RandomAccessIterator1 first,
+                                  RandomAccessIterator1 last,
+                                  RandomAccessIterator2 stencil,
+                                  Predicate pred,
+                                  thrust::random_access_traversal_tag)
+{
+  namespace internal = thrust::system::detail::internal::partition_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = last - first;
+
+  if(n == 0) return first;
+
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp(n, 1, thrust::min<unsigned int>(p, internal::max_tiles));
+
+  const Size num_tiles = decomp.size();
+
+  Size true_counts[internal::max_tiles];
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_partition_body(first, stencil, wrapped_pred, decomp, true_counts), ::tbb::simple_partitioner());
+
+  Size num_true = 0;
+
+  for(Size t = 0; t < num_tiles; ++t)
+  {
+    num_true += true_counts[t];
+  }
+
+  const Size num_misplaced = internal::count_misplaced(decomp, true_counts, num_true);
+
+  if(num_misplaced > 0)
+  {
+    Decomposition swaps(num_misplaced, 1, p);
+
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, swaps.size(), 1), make_swap_body(first, decomp, true_counts, num_true, swaps), ::tbb::simple_partitioner());
+  }
+
+  return first + num_true;
+} // end partition()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator stable_partition(execution_policy<DerivedPolicy> &exec,
+                                   ForwardIterator first,
+                                   ForwardIterator last,
+                                   InputIterator stencil,
+                                   Predicate pred,
+                                   thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+} // end stable_partition()
+
+
+// each tile's true elements are counted, and each tile then moves its true
+// elements to its front and copies its false elements directly to their
+// place in a buffer holding only the false elements. the tiles' true
+// elements are finally moved down, in order, and followed by the buffer
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Predicate>
+  RandomAccessIterator1 stable_partition(execution_policy<DerivedPolicy> &exec,
+                                         RandomAccessIterator1 first,
+                                         RandomAccessIterator1 last,
+                                         RandomAccessIterator2 stencil,
+                                         Predicate pred,
+                                         thrust::random_access_traversal_tag)
+{
+  namespace internal = thrust::system::detail::internal::partition_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      value_type;
+
+  const Size n = last - first;
+
+  if(n == 0) return first;
+
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp(n, 1, p);
+
+  const Size num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_tiles + 1);
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_count_body(stencil, wrapped_pred, decomp, offsets), ::tbb::simple_partitioner());
+
+  offsets[0] = 0;
+
+  for(Size t = 0; t < num_tiles; ++t)
+  {
+    offsets[t + 1] += offsets[t];
+  }
+
+  const Size num_true = offsets[num_tiles];
+
+  // nothing moves unless there are elements of both kinds
+  if(num_true == 0 || num_true == n)
+  {
+    return first + num_true;
+  }
+
+  thrust::detail::temporary_array<value_type,DerivedPolicy> falses_storage(exec, n - num_true);
+  value_type *falses = thrust::raw_pointer_cast(&*falses_storage.begin());
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_stable_partition_body(first, stencil, falses, wrapped_pred, decomp, offsets), ::tbb::simple_partitioner());
+
+  // the destination of each tile's true elements lies below those of the
+  // tiles after it, so moving the tiles in order overwrites none unmoved
+  for(Size t = 1; t < num_tiles; ++t)
+  {
+    thrust::system::detail::internal::move_down(exec, first, decomp[t].begin(), offsets[t], offsets[t + 1] - offsets[t]);
+  }
+
+  thrust::copy(exec, falses, falses + (n - num_true), first + num_true);
+
+  return first + num_true;
+} // end stable_partition()
+
+
+} // end partition_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            Predicate pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return thrust::system::tbb::detail::partition_detail::partition(exec, first, last, first, pred, traversal());
+} // end partition()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename InputIterator,
+         typename Predicate>
+  ForwardIterator partition(execution_policy<DerivedPolicy> &exec,
+                            ForwardIterator first,
+                            ForwardIterator last,
+                            InputIterator stencil,
+                            Predicate pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal1;
+  typedef typename thrust::iterator_traversal<InputIterator>::type   traversal2;
+
+  typedef typename thrust::detail::minimum_type<traversal1,traversal2>::type traversal;
+
+  return thrust::system::tbb::detail::partition_detail::partition(exec, first, last, stencil, pred, traversal());
+} // end partition()
 
 
 template<typename DerivedPolicy,
@@ -38,8 +394,9 @@ template<typename DerivedPolicy,
                                    ForwardIterator last,
                                    Predicate pred)
 {
-  // tbb prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return thrust::system::tbb::detail::partition_detail::stable_partition(exec, first, last, first, pred, traversal());
 } // end stable_partition()
 
 
@@ -53,10 +410,15 @@ template<typename DerivedPolicy,
                                    InputIterator stencil,
                                    Predicate pred)
 {
-  // tbb prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal1;
+  typedef typename thrust::iterator_traversal<InputIterator>::type   traversal2;
+
+  typedef typename thrust::detail::minimum_type<traversal1,traversal2>::type traversal;
+
+  return thrust::system::tbb::detail::partition_detail::stable_partition(exec, first, last, stencil, pred, traversal());
 } // end stable_partition()
 
+
 template<typename DerivedPolicy,
          typename InputIterator,
          typename OutputIterator1,
@@ -23,6 +23,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/reduce.h>
+#include <thrust/system/tbb/detail/tuning.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
 
@@ -118,7 +119,7 @@ template<typename DerivedPolicy,
   {
     typedef typename reduce_detail::body<InputIterator,OutputType,BinaryFunction> Body;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0,n), reduce_body);
+    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n, grain_size(exec)), reduce_body);
     return binary_op(init, reduce_body.sum);
   }
 }
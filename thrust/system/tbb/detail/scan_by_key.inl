@@ -0,0 +1,315 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/scan_by_key.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/system/tbb/detail/tuning.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_scan.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename ValueType>
+struct inclusive_body
+{
+  InputIterator1 keys;
+  InputIterator2 input;
+  OutputIterator output;
+  thrust::detail::wrapped_function<BinaryPredicate,bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> binary_op;
+  ValueType sum;
+  bool has_head;
+  bool first_call;
+
+  inclusive_body(InputIterator1 keys, InputIterator2 input, OutputIterator output, BinaryPredicate binary_pred, BinaryFunction binary_op, ValueType dummy)
+    : keys(keys), input(input), output(output), binary_pred(binary_pred), binary_op(binary_op), sum(dummy), has_head(false), first_call(true)
+  {}
+
+  inclusive_body(inclusive_body& b, ::tbb::split)
+    : keys(b.keys), input(b.input), output(b.output), binary_pred(b.binary_pred), binary_op(b.binary_op), sum(b.sum), has_head(false), first_call(true)
+  {}
+
+  template<typename Size>
+  bool is_head(Size i)
+  {
+    return (i == 0) || !binary_pred(keys[i - 1], keys[i]);
+  }
+
+  // sums the segment which is still open at the end of r; has_head records
+  // whether that sum is independent of the elements preceding r
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    bool head = is_head(r.begin());
+
+    ValueType temp = input[r.begin()];
+
+    for(Size i = r.begin() + 1; i != r.end(); ++i)
+    {
+      if(is_head(i))
+      {
+        temp = input[i];
+        head = true;
+      }
+      else
+      {
+        temp = binary_op(temp, input[i]);
+      }
+    }
+
+    if(first_call || head)
+      sum = temp;
+    else
+      sum = binary_op(sum, temp);
+
+    has_head = (!first_call && has_head) || head;
+
+    first_call = false;
+  }
+
+  // the sum carried into r only matters if r begins inside a segment,
+  // which is never the case for the first range
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      if(is_head(i))
+        sum = input[i];
+      else
+        sum = binary_op(sum, input[i]);
+
+      output[i] = sum;
+    }
+
+    first_call = false;
+  }
+
+  void reverse_join(inclusive_body& b)
+  {
+    if(!has_head)
+    {
+      sum = binary_op(b.sum, sum);
+      has_head = b.has_head;
+    }
+  }
+
+  void assign(inclusive_body& b)
+  {
+    sum = b.sum;
+    has_head = b.has_head;
+  }
+};
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction,
+         typename ValueType>
+struct exclusive_body
+{
+  InputIterator1 keys;
+  InputIterator2 input;
+  OutputIterator output;
+  thrust::detail::wrapped_function<BinaryPredicate,bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> binary_op;
+  ValueType init;
+  ValueType sum;
+  bool has_head;
+  bool first_call;
+
+  exclusive_body(InputIterator1 keys, InputIterator2 input, OutputIterator output, BinaryPredicate binary_pred, BinaryFunction binary_op, ValueType init)
+    : keys(keys), input(input), output(output), binary_pred(binary_pred), binary_op(binary_op), init(init), sum(init), has_head(false), first_call(true)
+  {}
+
+  exclusive_body(exclusive_body& b, ::tbb::split)
+    : keys(b.keys), input(b.input), output(b.output), binary_pred(b.binary_pred), binary_op(b.binary_op), init(b.init), sum(b.sum), has_head(false), first_call(true)
+  {}
+
+  template<typename Size>
+  bool is_head(Size i)
+  {
+    return (i == 0) || !binary_pred(keys[i - 1], keys[i]);
+  }
+
+  // sums the segment which is still open at the end of r; has_head records
+  // whether that sum is independent of the elements preceding r
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    bool head = is_head(r.begin());
+
+    ValueType temp = head ? binary_op(init, input[r.begin()]) : ValueType(input[r.begin()]);
+
+    for(Size i = r.begin() + 1; i != r.end(); ++i)
+    {
+      if(is_head(i))
+      {
+        temp = binary_op(init, input[i]);
+        head = true;
+      }
+      else
+      {
+        temp = binary_op(temp, input[i]);
+      }
+    }
+
+    if(first_call || head)
+      sum = temp;
+    else
+      sum = binary_op(sum, temp);
+
+    has_head = (!first_call && has_head) || head;
+
+    first_call = false;
+  }
+
+  // the sum carried into r only matters if r begins inside a segment,
+  // which is never the case for the first range
+  template<typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      if(is_head(i))
+        sum = init;
+
+      // use a temporary to permit in-place scans
+      ValueType temp = binary_op(sum, input[i]);
+      output[i] = sum;
+      sum = temp;
+    }
+
+    first_call = false;
+  }
+
+  void reverse_join(exclusive_body& b)
+  {
+    if(!has_head)
+    {
+      sum = binary_op(b.sum, sum);
+      has_head = b.has_head;
+    }
+  }
+
+  void assign(exclusive_body& b)
+  {
+    sum = b.sum;
+    has_head = b.has_head;
+  }
+};
+
+
+} // end namespace scan_by_key_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_traits<OutputIterator>::value_type ValueType;
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  Size n = thrust::distance(first1, last1);
+
+  if (n != 0)
+  {
+    typedef typename scan_by_key_detail::inclusive_body<InputIterator1,InputIterator2,OutputIterator,BinaryPredicate,BinaryFunction,ValueType> Body;
+    Body scan_body(first1, first2, result, binary_pred, binary_op, *first2);
+    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain_size(exec)), scan_body);
+  }
+
+  thrust::advance(result, n);
+
+  return result;
+} // end inclusive_scan_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       T init,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_traits<OutputIterator>::value_type ValueType;
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  Size n = thrust::distance(first1, last1);
+
+  if (n != 0)
+  {
+    typedef typename scan_by_key_detail::exclusive_body<InputIterator1,InputIterator2,OutputIterator,BinaryPredicate,BinaryFunction,ValueType> Body;
+    Body scan_body(first1, first2, result, binary_pred, binary_op, init);
+    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n, grain_size(exec)), scan_body);
+  }
+
+  thrust::advance(result, n);
+
+  return result;
+} // end exclusive_scan_by_key()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
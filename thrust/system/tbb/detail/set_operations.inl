@@ -0,0 +1,312 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/set_operations.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/distance.h>
+#include <thrust/advance.h>
+#include <thrust/pair.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/tbb_thread.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+
+template<typename InputIterator1, typename InputIterator2, typename Decomposition, typename StrictWeakOrdering>
+struct partition_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  InputIterator1 first1;
+  Size n1;
+  InputIterator2 first2;
+  Size n2;
+  Decomposition decomp;
+  StrictWeakOrdering comp;
+  Size *splits1;
+  Size *splits2;
+
+  partition_body(InputIterator1 first1, Size n1, InputIterator2 first2, Size n2, Decomposition decomp, StrictWeakOrdering comp, Size *splits1, Size *splits2)
+    : first1(first1), n1(n1), first2(first2), n2(n2), decomp(decomp), comp(comp), splits1(splits1), splits2(splits2)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      Size diag = (i < decomp.size()) ? decomp[i].begin() : n1 + n2;
+
+      thrust::pair<Size,Size> split = thrust::system::detail::internal::balanced_path(diag, first1, n1, first2, n2, comp);
+
+      splits1[i] = split.first;
+      splits2[i] = split.second;
+    }
+  }
+};
+
+
+template<typename InputIterator1, typename InputIterator2, typename Decomposition, typename StrictWeakOrdering>
+  partition_body<InputIterator1,InputIterator2,Decomposition,StrictWeakOrdering>
+    make_partition_body(InputIterator1 first1, typename Decomposition::index_type n1,
+                        InputIterator2 first2, typename Decomposition::index_type n2,
+                        Decomposition decomp, StrictWeakOrdering comp,
+                        typename Decomposition::index_type *splits1,
+                        typename Decomposition::index_type *splits2)
+{
+  return partition_body<InputIterator1,InputIterator2,Decomposition,StrictWeakOrdering>(first1, n1, first2, n2, decomp, comp, splits1, splits2);
+}
+
+
+template<typename InputIterator1, typename InputIterator2, typename Size, typename StrictWeakOrdering, typename SetOperation>
+struct count_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  StrictWeakOrdering comp;
+  SetOperation set_op;
+  const Size *splits1;
+  const Size *splits2;
+  Size *counts;
+
+  count_body(InputIterator1 first1, InputIterator2 first2, StrictWeakOrdering comp, SetOperation set_op, const Size *splits1, const Size *splits2, Size *counts)
+    : first1(first1), first2(first2), comp(comp), set_op(set_op), splits1(splits1), splits2(splits2), counts(counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::discard_iterator<> discard;
+
+      counts[i] = set_op(first1 + splits1[i], first1 + splits1[i + 1],
+                         first2 + splits2[i], first2 + splits2[i + 1],
+                         discard,
+                         comp) - discard;
+    }
+  }
+};
+
+
+template<typename InputIterator1, typename InputIterator2, typename Size, typename StrictWeakOrdering, typename SetOperation>
+  count_body<InputIterator1,InputIterator2,Size,StrictWeakOrdering,SetOperation>
+    make_count_body(InputIterator1 first1, InputIterator2 first2, StrictWeakOrdering comp, SetOperation set_op, const Size *splits1, const Size *splits2, Size *counts)
+{
+  return count_body<InputIterator1,InputIterator2,Size,StrictWeakOrdering,SetOperation>(first1, first2, comp, set_op, splits1, splits2, counts);
+}
+
+
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Size, typename StrictWeakOrdering, typename SetOperation>
+struct write_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  OutputIterator result;
+  StrictWeakOrdering comp;
+  SetOperation set_op;
+  const Size *splits1;
+  const Size *splits2;
+  const Size *offsets;
+
+  write_body(InputIterator1 first1, InputIterator2 first2, OutputIterator result, StrictWeakOrdering comp, SetOperation set_op, const Size *splits1, const Size *splits2, const Size *offsets)
+    : first1(first1), first2(first2), result(result), comp(comp), set_op(set_op), splits1(splits1), splits2(splits2), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      set_op(first1 + splits1[i], first1 + splits1[i + 1],
+             first2 + splits2[i], first2 + splits2[i + 1],
+             result + offsets[i],
+             comp);
+    }
+  }
+};
+
+
+template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Size, typename StrictWeakOrdering, typename SetOperation>
+  write_body<InputIterator1,InputIterator2,OutputIterator,Size,StrictWeakOrdering,SetOperation>
+    make_write_body(InputIterator1 first1, InputIterator2 first2, OutputIterator result, StrictWeakOrdering comp, SetOperation set_op, const Size *splits1, const Size *splits2, const Size *offsets)
+{
+  return write_body<InputIterator1,InputIterator2,OutputIterator,Size,StrictWeakOrdering,SetOperation>(first1, first2, result, comp, set_op, splits1, splits2, offsets);
+}
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering,
+         typename SetOperation>
+OutputIterator set_operation(execution_policy<DerivedPolicy> &exec,
+                             InputIterator1 first1,
+                             InputIterator1 last1,
+                             InputIterator2 first2,
+                             InputIterator2 last2,
+                             OutputIterator result,
+                             StrictWeakOrdering comp,
+                             SetOperation set_op)
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+
+  const Size n1 = thrust::distance(first1, last1);
+  const Size n2 = thrust::distance(first2, last2);
+
+  if(n1 + n2 == 0)
+    return result;
+
+  // split the merged inputs into one interval per processor
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp(n1 + n2, 1, p);
+
+  const Size num_intervals = decomp.size();
+
+  // a single interval needs neither the split nor the counting pass
+  if(num_intervals == 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> splits1_storage(exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size,DerivedPolicy> splits2_storage(exec, num_intervals + 1);
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_intervals + 1);
+
+  Size *splits1 = thrust::raw_pointer_cast(&*splits1_storage.begin());
+  Size *splits2 = thrust::raw_pointer_cast(&*splits2_storage.begin());
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  // find where each split falls in the inputs
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals + 1, 1), make_partition_body(first1, n1, first2, n2, decomp, comp, splits1, splits2), ::tbb::simple_partitioner());
+
+  // count the output of each interval
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1), make_count_body(first1, first2, comp, set_op, splits1, splits2, offsets + 1), ::tbb::simple_partitioner());
+
+  // scan the (few) counts serially
+  offsets[0] = 0;
+
+  for(Size i = 0; i < num_intervals; ++i)
+  {
+    offsets[i + 1] += offsets[i];
+  }
+
+  // write the output of each interval at its offset
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1), make_write_body(first1, first2, result, comp, set_op, splits1, splits2, offsets), ::tbb::simple_partitioner());
+
+  thrust::advance(result, offsets[num_intervals]);
+
+  return result;
+} // end set_operation()
+
+
+} // end namespace set_operations_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_difference(execution_policy<DerivedPolicy> &exec,
+                              InputIterator1 first1,
+                              InputIterator1 last1,
+                              InputIterator2 first2,
+                              InputIterator2 last2,
+                              OutputIterator result,
+                              StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference());
+} // end set_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_intersection(execution_policy<DerivedPolicy> &exec,
+                                InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection());
+} // end set_intersection()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(execution_policy<DerivedPolicy> &exec,
+                                        InputIterator1 first1,
+                                        InputIterator1 last1,
+                                        InputIterator2 first2,
+                                        InputIterator2 last2,
+                                        OutputIterator result,
+                                        StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_symmetric_difference());
+} // end set_symmetric_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator set_union(execution_policy<DerivedPolicy> &exec,
+                         InputIterator1 first1,
+                         InputIterator1 last1,
+                         InputIterator2 first2,
+                         InputIterator2 last2,
+                         OutputIterator result,
+                         StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union());
+} // end set_union()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
@@ -20,8 +20,23 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/merge.h>
+#include <thrust/reverse.h>
 #include <thrust/detail/seq.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/system/tbb/detail/stable_radix_sort.h>
+#include <thrust/system/tbb/detail/tuning.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/bounded_merge_sort.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/minmax.h>
 #include <tbb/parallel_invoke.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#include <tbb/partitioner.h>
+#include <tbb/tbb_thread.h>
 
 namespace thrust
 {
@@ -35,9 +50,6 @@ namespace sort_detail
 {
 
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
   
 template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy> &exec, Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp, bool inplace);
@@ -67,10 +79,11 @@ template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typenam
 void merge_sort(execution_policy<DerivedPolicy> &exec, Iterator1 first1, Iterator1 last1, Iterator2 first2, StrictWeakOrdering comp, bool inplace)
 {
   typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
+  typedef typename thrust::iterator_value<Iterator1>::type      value_type;
 
   difference_type n = thrust::distance(first1, last1);
 
-  if (n < threshold)
+  if (static_cast<std::size_t>(n) < sort_threshold(exec, sizeof(value_type)))
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
     
@@ -105,9 +118,6 @@ namespace sort_by_key_detail
 {
 
 
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
   
 template<typename DerivedPolicy,
          typename Iterator1,
@@ -175,6 +185,8 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
                        bool inplace)
 {
   typedef typename thrust::iterator_difference<Iterator1>::type difference_type;
+  typedef typename thrust::iterator_value<Iterator1>::type      key_type;
+  typedef typename thrust::iterator_value<Iterator2>::type      value_type;
 
   difference_type n = thrust::distance(first1, last1);
   
@@ -185,7 +197,7 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  if (static_cast<std::size_t>(n) < sort_threshold(exec, sizeof(key_type) + sizeof(value_type)))
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
     
@@ -219,13 +231,353 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
 } // end namespace sort_detail
 
 
+namespace bounded_sort_detail
+{
+
+
+// returns the beginning of tile i, or the end of the last tile if i is past the end
+template<typename Decomposition>
+typename Decomposition::index_type tile_begin(const Decomposition &decomp, typename Decomposition::index_type i)
+{
+  return (i < decomp.size()) ? decomp[i].begin() : decomp[decomp.size() - 1].end();
+}
+
+
+template<typename RandomAccessIterator>
+struct reverse_body
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  RandomAccessIterator first, last;
+
+  reverse_body(RandomAccessIterator first, RandomAccessIterator last)
+    : first(first), last(last)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::bounded_merge_sort_detail::exchange(first + i, last - 1 - i);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator>
+void parallel_reverse(RandomAccessIterator first, RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size half = (last - first) / 2;
+
+  // small ranges are not worth spawning tasks
+  if(half < (1 << 14))
+  {
+    thrust::system::detail::internal::bounded_merge_sort_detail::reverse(first, last);
+    return;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, half, 1 << 12), reverse_body<RandomAccessIterator>(first, last));
+}
+
+
+struct parallel_rotate
+{
+  template<typename RandomAccessIterator>
+  void operator()(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+  {
+    parallel_reverse(first, middle);
+    parallel_reverse(middle, last);
+    parallel_reverse(first, last);
+  }
+};
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Decomposition, typename StrictWeakOrdering>
+struct tile_sort_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator1 first;
+  RandomAccessIterator2 buffer;
+  Size tile_scratch;
+  Decomposition decomp;
+  StrictWeakOrdering comp;
+
+  tile_sort_body(RandomAccessIterator1 first, RandomAccessIterator2 buffer, Size tile_scratch, Decomposition decomp, StrictWeakOrdering comp)
+    : first(first), buffer(buffer), tile_scratch(tile_scratch), decomp(decomp), comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::buffered_merge_sort(first + decomp[i].begin(), first + decomp[i].end(), buffer + i * tile_scratch, tile_scratch, comp);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Decomposition, typename StrictWeakOrdering>
+  tile_sort_body<RandomAccessIterator1,RandomAccessIterator2,Decomposition,StrictWeakOrdering>
+    make_tile_sort_body(RandomAccessIterator1 first, RandomAccessIterator2 buffer, typename Decomposition::index_type tile_scratch, Decomposition decomp, StrictWeakOrdering comp)
+{
+  return tile_sort_body<RandomAccessIterator1,RandomAccessIterator2,Decomposition,StrictWeakOrdering>(first, buffer, tile_scratch, decomp, comp);
+}
+
+
+template<typename RandomAccessIterator, typename Decomposition, typename StrictWeakOrdering>
+struct split_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator first;
+  Decomposition decomp;
+  Size run_width;
+  StrictWeakOrdering comp;
+  Size *splits;
+
+  split_body(RandomAccessIterator first, Decomposition decomp, Size run_width, StrictWeakOrdering comp, Size *splits)
+    : first(first), decomp(decomp), run_width(run_width), comp(comp), splits(splits)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      Size pair_tile = (i / (2 * run_width)) * (2 * run_width);
+
+      Size begin1 = tile_begin(decomp, pair_tile);
+      Size begin2 = tile_begin(decomp, pair_tile + run_width);
+      Size end2   = tile_begin(decomp, pair_tile + 2 * run_width);
+
+      splits[i] = thrust::system::detail::internal::merge_path(decomp[i].begin() - begin1, first + begin1, begin2 - begin1, first + begin2, end2 - begin2, comp);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename Decomposition, typename StrictWeakOrdering>
+  split_body<RandomAccessIterator,Decomposition,StrictWeakOrdering>
+    make_split_body(RandomAccessIterator first, Decomposition decomp, typename Decomposition::index_type run_width, StrictWeakOrdering comp, typename Decomposition::index_type *splits)
+{
+  return split_body<RandomAccessIterator,Decomposition,StrictWeakOrdering>(first, decomp, run_width, comp, splits);
+}
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Decomposition, typename StrictWeakOrdering>
+struct piece_merge_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator1 first;
+  RandomAccessIterator2 buffer;
+  Size tile_scratch;
+  Decomposition decomp;
+  Size run_width;
+  StrictWeakOrdering comp;
+  const Size *splits;
+
+  piece_merge_body(RandomAccessIterator1 first, RandomAccessIterator2 buffer, Size tile_scratch, Decomposition decomp, Size run_width, StrictWeakOrdering comp, const Size *splits)
+    : first(first), buffer(buffer), tile_scratch(tile_scratch), decomp(decomp), run_width(run_width), comp(comp), splits(splits)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    const Size num_tiles = decomp.size();
+
+    for(Size i = r.begin(); i != r.end(); ++i)
+    {
+      Size pair_tile = (i / (2 * run_width)) * (2 * run_width);
+
+      // a run without a partner is already in place
+      if(pair_tile + run_width >= num_tiles) continue;
+
+      Size begin1 = tile_begin(decomp, pair_tile);
+      Size begin2 = tile_begin(decomp, pair_tile + run_width);
+
+      Size next_split = (i + 1 < thrust::min<Size>(pair_tile + 2 * run_width, num_tiles)) ? splits[i + 1] : begin2 - begin1;
+
+      thrust::system::detail::internal::buffered_merge(first + decomp[i].begin(),
+                                                       first + decomp[i].begin() + (next_split - splits[i]),
+                                                       first + decomp[i].end(),
+                                                       buffer + i * tile_scratch,
+                                                       tile_scratch,
+                                                       comp);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename Decomposition, typename StrictWeakOrdering>
+  piece_merge_body<RandomAccessIterator1,RandomAccessIterator2,Decomposition,StrictWeakOrdering>
+    make_piece_merge_body(RandomAccessIterator1 first, RandomAccessIterator2 buffer, typename Decomposition::index_type tile_scratch, Decomposition decomp,
+                          typename Decomposition::index_type run_width, StrictWeakOrdering comp, const typename Decomposition::index_type *splits)
+{
+  return piece_merge_body<RandomAccessIterator1,RandomAccessIterator2,Decomposition,StrictWeakOrdering>(first, buffer, tile_scratch, decomp, run_width, comp, splits);
+}
+
+
+// a stable merge sort whose temporary storage is at most scratch_fraction * n elements.
+// every tile is sorted with its own slice of the scratch. every merge pass splits each
+// pair of runs into one piece per tile, moves each piece's parts together with
+// rotations, and merges the pieces in place, each with its own slice of the scratch
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void bounded_stable_merge_sort(execution_policy<DerivedPolicy> &exec,
+                               RandomAccessIterator first,
+                               RandomAccessIterator last,
+                               StrictWeakOrdering comp,
+                               double scratch_fraction)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
+
+  const Size n = last - first;
+
+  if(n < 2) return;
+
+  // at least one tile per processor
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp(n, 1, thrust::system::detail::internal::bounded_sort_num_tiles(n, Size(p)));
+
+  const Size num_tiles = decomp.size();
+
+  Size scratch = (scratch_fraction > 0) ? static_cast<Size>(scratch_fraction * n) : 0;
+  if(scratch > n) scratch = n;
+
+  const Size tile_scratch = scratch / num_tiles;
+
+  thrust::detail::temporary_array<value_type,DerivedPolicy> buffer(exec, tile_scratch * num_tiles);
+
+  // force grainsize == 1 with simple_partioner()
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_tile_sort_body(first, buffer.begin(), tile_scratch, decomp, comp), ::tbb::simple_partitioner());
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> splits_storage(exec, num_tiles);
+  thrust::detail::temporary_array<Size,DerivedPolicy> diag_storage(exec, num_tiles + 1);
+  thrust::detail::temporary_array<Size,DerivedPolicy> lhs_storage(exec, num_tiles + 1);
+
+  Size *splits = thrust::raw_pointer_cast(&*splits_storage.begin());
+  Size *diag   = thrust::raw_pointer_cast(&*diag_storage.begin());
+  Size *lhs    = thrust::raw_pointer_cast(&*lhs_storage.begin());
+
+  parallel_rotate rotate;
+
+  for(Size run_width = 1; run_width < num_tiles; run_width *= 2)
+  {
+    // find where each tile of the output falls in its pair of runs
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_split_body(first, decomp, run_width, comp, splits), ::tbb::simple_partitioner());
+
+    // move the parts of each piece together
+    for(Size pair_tile = 0; pair_tile + run_width < num_tiles; pair_tile += 2 * run_width)
+    {
+      Size num_pieces = thrust::min<Size>(2 * run_width, num_tiles - pair_tile);
+
+      Size begin1 = tile_begin(decomp, pair_tile);
+      Size begin2 = tile_begin(decomp, pair_tile + run_width);
+      Size end2   = tile_begin(decomp, pair_tile + 2 * run_width);
+
+      for(Size j = 0; j < num_pieces; ++j)
+      {
+        diag[j] = decomp[pair_tile + j].begin() - begin1;
+        lhs[j]  = splits[pair_tile + j];
+      }
+
+      diag[num_pieces] = end2 - begin1;
+      lhs[num_pieces]  = begin2 - begin1;
+
+      thrust::system::detail::internal::interleave_pieces(first + begin1, diag, lhs, Size(0), num_pieces, rotate);
+    }
+
+    // merge every piece in place
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_piece_merge_body(first, buffer.begin(), tile_scratch, decomp, run_width, comp, splits), ::tbb::simple_partitioner());
+  }
+}
+
+
+} // end namespace bounded_sort_detail
+
+
+namespace sort_detail
+{
+
+
+////////////////
+// Radix Sort //
+////////////////
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
 void stable_sort(execution_policy<DerivedPolicy> &exec,
                  RandomAccessIterator first,
                  RandomAccessIterator last,
-                 StrictWeakOrdering comp)
+                 StrictWeakOrdering,
+                 thrust::detail::true_type)
+{
+  thrust::system::tbb::detail::stable_radix_sort(exec, first, last);
+
+  // if comp is greater<T> then reverse the keys
+  typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
+
+  if(thrust::system::detail::internal::radix_sort_detail::needs_reverse<KeyType,StrictWeakOrdering>::value)
+  {
+    thrust::reverse(exec, first, last);
+  }
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 first1,
+                        RandomAccessIterator1 last1,
+                        RandomAccessIterator2 first2,
+                        StrictWeakOrdering,
+                        thrust::detail::true_type)
+{
+  // if comp is greater<T> then reverse the keys and values
+  typedef typename thrust::iterator_traits<RandomAccessIterator1>::value_type KeyType;
+
+  const bool reverse = thrust::system::detail::internal::radix_sort_detail::needs_reverse<KeyType,StrictWeakOrdering>::value;
+
+  // note, we also have to reverse the (unordered) input to preserve stability
+  if(reverse)
+  {
+    thrust::reverse(exec, first1, last1);
+    thrust::reverse(exec, first2, first2 + (last1 - first1));
+  }
+
+  thrust::system::tbb::detail::stable_radix_sort_by_key(exec, first1, last1, first2);
+
+  if(reverse)
+  {
+    thrust::reverse(exec, first1, last1);
+    thrust::reverse(exec, first2, first2 + (last1 - first1));
+  }
+}
+
+
+////////////////
+// Merge Sort //
+////////////////
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
 
@@ -239,11 +591,12 @@ template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename StrictWeakOrdering>
-  void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
-                          RandomAccessIterator1 first1,
-                          RandomAccessIterator1 last1,
-                          RandomAccessIterator2 first2,
-                          StrictWeakOrdering comp)
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 first1,
+                        RandomAccessIterator1 last1,
+                        RandomAccessIterator2 first2,
+                        StrictWeakOrdering comp,
+                        thrust::detail::false_type)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
   typedef typename thrust::iterator_value<RandomAccessIterator2>::type val_type;
@@ -257,6 +610,71 @@ template<typename DerivedPolicy,
 }
 
 
+} // end namespace sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<key_type,StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 first1,
+                          RandomAccessIterator1 last1,
+                          RandomAccessIterator2 first2,
+                          StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
+  thrust::system::detail::internal::radix_sort_detail::use_radix_sort<key_type,StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);
+}
+
+
+template<typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+  void stable_sort(execute_with_bounded_memory &exec,
+                   RandomAccessIterator first,
+                   RandomAccessIterator last,
+                   StrictWeakOrdering comp)
+{
+  // radix sort needs scratch as large as its input, so every key type is merge sorted
+  bounded_sort_detail::bounded_stable_merge_sort(exec, first, last, comp, exec.m_scratch_fraction);
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void stable_sort_by_key(execute_with_bounded_memory &exec,
+                          RandomAccessIterator1 first1,
+                          RandomAccessIterator1 last1,
+                          RandomAccessIterator2 first2,
+                          StrictWeakOrdering comp)
+{
+  // sort the keys and values as pairs, so that the scratch holds pairs too
+  bounded_sort_detail::bounded_stable_merge_sort(exec,
+                                                 thrust::make_zip_iterator(thrust::make_tuple(first1, first2)),
+                                                 thrust::make_zip_iterator(thrust::make_tuple(last1, first2 + (last1 - first1))),
+                                                 thrust::detail::compare_first<StrictWeakOrdering>(comp),
+                                                 exec.m_scratch_fraction);
+}
+
+
 } // end namespace detail
 } // end namespace tbb
 } // end namespace system
@@ -0,0 +1,257 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/stable_radix_sort.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/radix_sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/copy.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/tbb_thread.h>
+#include <cstddef>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace radix_sort_detail
+{
+
+
+template<typename RandomAccessIterator, typename Decomposition>
+struct histogram_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator keys;
+  Decomposition decomp;
+  unsigned int pass;
+  size_t *histograms;
+
+  histogram_body(RandomAccessIterator keys, Decomposition decomp, unsigned int pass, size_t *histograms)
+    : keys(keys), decomp(decomp), pass(pass), histograms(histograms)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      radix::histogram_tile(keys, decomp[t].begin(), decomp[t].end(), pass, histograms + t * radix::radix_size);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename Decomposition>
+  histogram_body<RandomAccessIterator,Decomposition>
+    make_histogram_body(RandomAccessIterator keys, Decomposition decomp, unsigned int pass, size_t *histograms)
+{
+  return histogram_body<RandomAccessIterator,Decomposition>(keys, decomp, pass, histograms);
+}
+
+
+template<bool HasValues,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition>
+struct scatter_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator1 keys_first;
+  RandomAccessIterator2 values_first;
+  RandomAccessIterator3 keys_result;
+  RandomAccessIterator4 values_result;
+  Decomposition decomp;
+  unsigned int pass;
+  size_t *offsets;
+
+  scatter_body(RandomAccessIterator1 keys_first, RandomAccessIterator2 values_first,
+               RandomAccessIterator3 keys_result, RandomAccessIterator4 values_result,
+               Decomposition decomp, unsigned int pass, size_t *offsets)
+    : keys_first(keys_first), values_first(values_first),
+      keys_result(keys_result), values_result(values_result),
+      decomp(decomp), pass(pass), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      radix::scatter_tile<HasValues>(keys_first, values_first, keys_result, values_result, decomp[t].begin(), decomp[t].end(), pass, offsets + t * radix::radix_size);
+    }
+  }
+};
+
+
+template<bool HasValues,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition>
+  scatter_body<HasValues,RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,RandomAccessIterator4,Decomposition>
+    make_scatter_body(RandomAccessIterator1 keys_first, RandomAccessIterator2 values_first,
+                      RandomAccessIterator3 keys_result, RandomAccessIterator4 values_result,
+                      Decomposition decomp, unsigned int pass, size_t *offsets)
+{
+  return scatter_body<HasValues,RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,RandomAccessIterator4,Decomposition>(keys_first, values_first, keys_result, values_result, decomp, pass, offsets);
+}
+
+
+// sorts (keys1, vals1) using (keys2, vals2) as scratch space
+template<bool HasValues,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size>
+void radix_sort(execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                Size n)
+{
+  namespace radix = thrust::system::detail::internal::radix_sort_detail;
+
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  // one tile per processor
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp(n, 1, p);
+
+  const Size num_tiles = decomp.size();
+
+  // one histogram per tile, reused by every pass
+  thrust::detail::temporary_array<size_t,DerivedPolicy> histograms_storage(exec, num_tiles * radix::radix_size);
+  size_t *histograms = thrust::raw_pointer_cast(&*histograms_storage.begin());
+
+  // true if the most recent data is stored in (keys2,vals2)
+  bool flip = false;
+
+  for(unsigned int pass = 0; pass < radix::radix_traits<KeyType>::num_passes; ++pass)
+  {
+    // count the digits of each tile
+    // force grainsize == 1 with simple_partioner()
+    if(flip)
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_histogram_body(keys2, decomp, pass, histograms), ::tbb::simple_partitioner());
+    }
+    else
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_histogram_body(keys1, decomp, pass, histograms), ::tbb::simple_partitioner());
+    }
+
+    // skip passes in which every key has the same digit
+    if(radix::scan_tile_histograms(histograms, num_tiles, static_cast<size_t>(n)))
+    {
+      continue;
+    }
+
+    // every tile scatters its keys to their positions within each digit's bucket
+    if(flip)
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_scatter_body<HasValues>(keys2, vals2, keys1, vals1, decomp, pass, histograms), ::tbb::simple_partitioner());
+    }
+    else
+    {
+      ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_scatter_body<HasValues>(keys1, vals1, keys2, vals2, decomp, pass, histograms), ::tbb::simple_partitioner());
+    }
+
+    flip = !flip;
+  }
+
+  // ensure final values are in (keys1,vals1)
+  if(flip)
+  {
+    thrust::copy(exec, keys2, keys2 + n, keys1);
+
+    if(HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + n, vals1);
+    }
+  }
+}
+
+
+} // end namespace radix_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+void stable_radix_sort(execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator first,
+                       RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  Size n = last - first;
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> temp(exec, n);
+
+  radix_sort_detail::radix_sort<false>(exec, first, temp.begin(), static_cast<int *>(0), static_cast<int *>(0), n);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+void stable_radix_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 keys_first,
+                              RandomAccessIterator1 keys_last,
+                              RandomAccessIterator2 values_first)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      ValueType;
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  Size n = keys_last - keys_first;
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   temp1(exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> temp2(exec, n);
+
+  radix_sort_detail::radix_sort<true>(exec, keys_first, temp1.begin(), values_first, temp2.begin(), n);
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
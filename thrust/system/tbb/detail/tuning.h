@@ -0,0 +1,222 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tuning.h
+ *  \brief Grain sizes and sequential cutoffs for the TBB backend.
+ *
+ *  The defaults are derived from the size of the elements being processed
+ *  and the sizes of the host's data caches. Each default may be fixed at
+ *  compile time by defining the corresponding macro before including Thrust,
+ *  and may be overridden for a single call with tbb::par.grain(n). Merges,
+ *  including those within merge sort, may be given a grain of their own with
+ *  tbb::par.grain(n).merge_grain(m).
+ *
+ *  THRUST_TBB_L1_CACHE_SIZE        bytes of L1 data cache assumed per core
+ *  THRUST_TBB_L2_CACHE_SIZE        bytes of L2 cache assumed per core
+ *  THRUST_TBB_SORT_THRESHOLD_BYTES bytes below which merge sort recurses no further
+ *  THRUST_TBB_MERGE_GRAIN_BYTES    bytes below which a merge is not split
+ *  THRUST_TBB_COPY_GRAIN_BYTES     bytes below which a trivial copy is not split
+ *
+ *  examples/tbb/calibrate_grain_size.cu measures THRUST_TBB_SORT_THRESHOLD_BYTES
+ *  and THRUST_TBB_MERGE_GRAIN_BYTES on the current machine and prints the
+ *  definitions to use.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/par.h>
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace tuning_detail
+{
+
+
+inline std::size_t query_cache_size(int which, std::size_t fallback)
+{
+  long result = -1;
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE)
+  result = ::sysconf(which == 1 ? _SC_LEVEL1_DCACHE_SIZE : _SC_LEVEL2_CACHE_SIZE);
+#else
+  (void) which;
+#endif
+
+  // sysconf reports 0 or -1 when the size is unknown
+  return result > 0 ? static_cast<std::size_t>(result) : fallback;
+}
+
+
+// a grain of zero means "not requested"
+template<typename DerivedPolicy>
+std::size_t requested_grain_size(const DerivedPolicy &)
+{
+  return 0;
+}
+
+
+inline std::size_t requested_grain_size(const execute_with_grain &exec)
+{
+  return exec.m_grain_size;
+}
+
+
+template<typename DerivedPolicy>
+std::size_t requested_merge_grain_size(const DerivedPolicy &)
+{
+  return 0;
+}
+
+
+// a merge grain which was not given separately follows the grain
+inline std::size_t requested_merge_grain_size(const execute_with_grain &exec)
+{
+  return exec.m_merge_grain_size ? exec.m_merge_grain_size : exec.m_grain_size;
+}
+
+
+} // end namespace tuning_detail
+
+
+inline std::size_t l1_cache_size()
+{
+#ifdef THRUST_TBB_L1_CACHE_SIZE
+  return THRUST_TBB_L1_CACHE_SIZE;
+#else
+  static const std::size_t result = tuning_detail::query_cache_size(1, 32 * 1024);
+  return result;
+#endif
+}
+
+
+inline std::size_t l2_cache_size()
+{
+#ifdef THRUST_TBB_L2_CACHE_SIZE
+  return THRUST_TBB_L2_CACHE_SIZE;
+#else
+  static const std::size_t result = tuning_detail::query_cache_size(2, 1024 * 1024);
+  return result;
+#endif
+}
+
+
+// a leaf of merge sort and its ping-pong buffer should fit in L2 together
+inline std::size_t sort_threshold_bytes()
+{
+#ifdef THRUST_TBB_SORT_THRESHOLD_BYTES
+  return THRUST_TBB_SORT_THRESHOLD_BYTES;
+#else
+  return l2_cache_size() / 2;
+#endif
+}
+
+
+// the inputs and output of a leaf merge should stay resident in L1
+inline std::size_t merge_grain_bytes()
+{
+#ifdef THRUST_TBB_MERGE_GRAIN_BYTES
+  return THRUST_TBB_MERGE_GRAIN_BYTES;
+#else
+  return l1_cache_size() / 8;
+#endif
+}
+
+
+// a memmove of this size costs far more than scheduling the task which runs it
+inline std::size_t copy_grain_bytes()
+{
+#ifdef THRUST_TBB_COPY_GRAIN_BYTES
+  return THRUST_TBB_COPY_GRAIN_BYTES;
+#else
+  return 2 * l2_cache_size();
+#endif
+}
+
+
+template<typename DerivedPolicy>
+std::size_t requested_grain_size(execution_policy<DerivedPolicy> &exec)
+{
+  return tuning_detail::requested_grain_size(thrust::detail::derived_cast(exec));
+}
+
+
+template<typename DerivedPolicy>
+std::size_t requested_merge_grain_size(execution_policy<DerivedPolicy> &exec)
+{
+  return tuning_detail::requested_merge_grain_size(thrust::detail::derived_cast(exec));
+}
+
+
+// the number of elements of size element_size below which merge sort sorts sequentially
+template<typename DerivedPolicy>
+std::size_t sort_threshold(execution_policy<DerivedPolicy> &exec, std::size_t element_size)
+{
+  std::size_t requested = requested_grain_size(exec);
+
+  return requested ? requested : thrust::max<std::size_t>(1024, sort_threshold_bytes() / element_size);
+}
+
+
+// the number of elements of size element_size below which a merge is not split
+template<typename DerivedPolicy>
+std::size_t merge_grain_size(execution_policy<DerivedPolicy> &exec, std::size_t element_size)
+{
+  std::size_t requested = requested_merge_grain_size(exec);
+
+  return requested ? requested : thrust::max<std::size_t>(64, merge_grain_bytes() / element_size);
+}
+
+
+// the number of elements of size element_size below which a trivial copy is not split
+template<typename DerivedPolicy>
+std::size_t copy_grain_size(execution_policy<DerivedPolicy> &exec, std::size_t element_size)
+{
+  std::size_t requested = requested_grain_size(exec);
+
+  return requested ? requested : thrust::max<std::size_t>(1, copy_grain_bytes() / element_size);
+}
+
+
+// the grain size of a blocked_range processed with the default auto_partitioner,
+// which already adapts chunk sizes to the load, so default to no minimum
+template<typename DerivedPolicy>
+std::size_t grain_size(execution_policy<DerivedPolicy> &exec)
+{
+  std::size_t requested = requested_grain_size(exec);
+
+  return requested ? requested : 1;
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
@@ -19,7 +19,19 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/unique.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/tbb/detail/unique_heads.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/unique.h>
+#include <thrust/system/detail/internal/move_down.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
 #include <thrust/pair.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/tbb_thread.h>
 
 namespace thrust
 {
@@ -29,6 +41,41 @@ namespace tbb
 {
 namespace detail
 {
+namespace unique_detail
+{
+
+
+template<typename RandomAccessIterator, typename BinaryPredicate, typename Decomposition>
+struct unique_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator first;
+  BinaryPredicate binary_pred;
+  Decomposition decomp;
+
+  unique_body(RandomAccessIterator first, BinaryPredicate binary_pred, Decomposition decomp)
+    : first(first), binary_pred(binary_pred), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace internal = thrust::system::detail::internal::unique_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      internal::unique_tile(first, decomp[t].begin(), decomp[t].end(), binary_pred);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename BinaryPredicate, typename Decomposition>
+  unique_body<RandomAccessIterator,BinaryPredicate,Decomposition>
+    make_unique_body(RandomAccessIterator first, BinaryPredicate binary_pred, Decomposition decomp)
+{
+  return unique_body<RandomAccessIterator,BinaryPredicate,Decomposition>(first, binary_pred, decomp);
+}
 
 
 template<typename DerivedPolicy,
@@ -37,13 +84,77 @@ template<typename DerivedPolicy,
   ForwardIterator unique(execution_policy<DerivedPolicy> &exec,
                          ForwardIterator first,
                          ForwardIterator last,
-                         BinaryPredicate binary_pred)
+                         BinaryPredicate binary_pred,
+                         thrust::incrementable_traversal_tag)
 {
   // tbb prefers generic::unique to cpp::unique
   return thrust::system::detail::generic::unique(exec,first,last,binary_pred);
 } // end unique()
 
 
+// each tile's unique elements are counted and moved to its front, and the
+// tiles are then moved down, in order, to the places given by the scan of
+// their counts. only one counter per tile of temporary storage is needed
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename BinaryPredicate>
+  RandomAccessIterator unique(execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator first,
+                              RandomAccessIterator last,
+                              BinaryPredicate binary_pred,
+                              thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type Size;
+
+  const Size n = last - first;
+
+  if(n == 0) return first;
+
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp(n, 1, p);
+
+  const Size num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_tiles + 1);
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_binary_pred(binary_pred);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_count_heads_body(first, wrapped_binary_pred, decomp, offsets), ::tbb::simple_partitioner());
+
+  const Size num_unique = scan_counts(offsets, num_tiles);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_unique_body(first, wrapped_binary_pred, decomp), ::tbb::simple_partitioner());
+
+  // each tile's destination lies below those of the tiles after it
+  for(Size t = 1; t < num_tiles; ++t)
+  {
+    thrust::system::detail::internal::move_down(exec, first, decomp[t].begin(), offsets[t], offsets[t + 1] - offsets[t]);
+  }
+
+  return first + num_unique;
+} // end unique()
+
+
+} // end unique_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+  ForwardIterator unique(execution_policy<DerivedPolicy> &exec,
+                         ForwardIterator first,
+                         ForwardIterator last,
+                         BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return thrust::system::tbb::detail::unique_detail::unique(exec, first, last, binary_pred, traversal());
+} // end unique()
+
+
 template<typename DerivedPolicy,
          typename InputIterator,
          typename OutputIterator,
@@ -59,6 +170,20 @@ template<typename DerivedPolicy,
 } // end unique_copy()
 
 
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+  typename thrust::iterator_difference<ForwardIterator>::type
+    unique_count(execution_policy<DerivedPolicy> &exec,
+                 ForwardIterator first,
+                 ForwardIterator last,
+                 BinaryPredicate binary_pred)
+{
+  // tbb prefers generic::unique_count to cpp::unique_count
+  return thrust::system::detail::generic::unique_count(exec,first,last,binary_pred);
+} // end unique_count()
+
+
 } // end namespace detail
 } // end namespace tbb 
 } // end namespace system
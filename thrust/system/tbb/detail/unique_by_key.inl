@@ -19,7 +19,20 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/unique_by_key.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/system/tbb/detail/unique_heads.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/unique.h>
+#include <thrust/system/detail/internal/move_down.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
 #include <thrust/pair.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/tbb_thread.h>
 
 namespace thrust
 {
@@ -31,6 +44,44 @@ namespace detail
 {
 
 
+namespace unique_by_key_detail
+{
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryPredicate, typename Decomposition>
+struct unique_by_key_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator1 keys_first;
+  RandomAccessIterator2 values_first;
+  BinaryPredicate binary_pred;
+  Decomposition decomp;
+
+  unique_by_key_body(RandomAccessIterator1 keys_first, RandomAccessIterator2 values_first, BinaryPredicate binary_pred, Decomposition decomp)
+    : keys_first(keys_first), values_first(values_first), binary_pred(binary_pred), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace internal = thrust::system::detail::internal::unique_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      internal::unique_by_key_tile(keys_first, values_first, decomp[t].begin(), decomp[t].end(), binary_pred);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1, typename RandomAccessIterator2, typename BinaryPredicate, typename Decomposition>
+  unique_by_key_body<RandomAccessIterator1,RandomAccessIterator2,BinaryPredicate,Decomposition>
+    make_unique_by_key_body(RandomAccessIterator1 keys_first, RandomAccessIterator2 values_first, BinaryPredicate binary_pred, Decomposition decomp)
+{
+  return unique_by_key_body<RandomAccessIterator1,RandomAccessIterator2,BinaryPredicate,Decomposition>(keys_first, values_first, binary_pred, decomp);
+}
+
+
 template<typename DerivedPolicy,
          typename ForwardIterator1,
          typename ForwardIterator2,
@@ -40,13 +91,86 @@ template<typename DerivedPolicy,
                   ForwardIterator1 keys_first, 
                   ForwardIterator1 keys_last,
                   ForwardIterator2 values_first,
-                  BinaryPredicate binary_pred)
+                  BinaryPredicate binary_pred,
+                  thrust::incrementable_traversal_tag)
 {
-  // tbb prefers generic::unique_by_key to cpp::unique_by_key
   return thrust::system::detail::generic::unique_by_key(exec,keys_first,keys_last,values_first,binary_pred);
 } // end unique_by_key()
 
 
+// unique_by_key compacts in place as unique does, moving values with keys
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename BinaryPredicate>
+  thrust::pair<RandomAccessIterator1,RandomAccessIterator2>
+    unique_by_key(execution_policy<DerivedPolicy> &exec,
+                  RandomAccessIterator1 keys_first, 
+                  RandomAccessIterator1 keys_last,
+                  RandomAccessIterator2 values_first,
+                  BinaryPredicate binary_pred,
+                  thrust::random_access_traversal_tag)
+{
+  namespace unique_detail = thrust::system::tbb::detail::unique_detail;
+
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type Size;
+
+  const Size n = keys_last - keys_first;
+
+  if(n == 0) return thrust::make_pair(keys_first, values_first);
+
+  const unsigned int p = thrust::max<unsigned int>(1u, ::tbb::tbb_thread::hardware_concurrency());
+
+  typedef thrust::system::detail::internal::uniform_decomposition<Size> Decomposition;
+  Decomposition decomp(n, 1, p);
+
+  const Size num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> offsets_storage(exec, num_tiles + 1);
+  Size *offsets = thrust::raw_pointer_cast(&*offsets_storage.begin());
+
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_binary_pred(binary_pred);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), unique_detail::make_count_heads_body(keys_first, wrapped_binary_pred, decomp, offsets), ::tbb::simple_partitioner());
+
+  const Size num_unique = unique_detail::scan_counts(offsets, num_tiles);
+
+  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_tiles, 1), make_unique_by_key_body(keys_first, values_first, wrapped_binary_pred, decomp), ::tbb::simple_partitioner());
+
+  // each tile's destination lies below those of the tiles after it
+  for(Size t = 1; t < num_tiles; ++t)
+  {
+    thrust::system::detail::internal::move_down(exec, keys_first,   decomp[t].begin(), offsets[t], offsets[t + 1] - offsets[t]);
+    thrust::system::detail::internal::move_down(exec, values_first, decomp[t].begin(), offsets[t], offsets[t + 1] - offsets[t]);
+  }
+
+  return thrust::make_pair(keys_first + num_unique, values_first + num_unique);
+} // end unique_by_key()
+
+
+} // end unique_by_key_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator1,
+         typename ForwardIterator2,
+         typename BinaryPredicate>
+  thrust::pair<ForwardIterator1,ForwardIterator2>
+    unique_by_key(execution_policy<DerivedPolicy> &exec,
+                  ForwardIterator1 keys_first, 
+                  ForwardIterator1 keys_last,
+                  ForwardIterator2 values_first,
+                  BinaryPredicate binary_pred)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator1>::type traversal1;
+  typedef typename thrust::iterator_traversal<ForwardIterator2>::type traversal2;
+
+  typedef typename thrust::detail::minimum_type<traversal1,traversal2>::type traversal;
+
+  return thrust::system::tbb::detail::unique_by_key_detail::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred, traversal());
+} // end unique_by_key()
+
+
 template<typename DerivedPolicy,
          typename InputIterator1,
          typename InputIterator2,
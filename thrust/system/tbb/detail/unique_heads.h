@@ -0,0 +1,95 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file unique_heads.h
+ *  \brief TBB body counting the first elements of each group of equal
+ *         elements, shared by unique and unique_by_key.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/internal/unique.h>
+#include <tbb/blocked_range.h>
+
+namespace thrust
+{
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace unique_detail
+{
+
+
+template<typename RandomAccessIterator, typename BinaryPredicate, typename Decomposition>
+struct count_heads_body
+{
+  typedef typename Decomposition::index_type Size;
+
+  RandomAccessIterator keys;
+  BinaryPredicate binary_pred;
+  Decomposition decomp;
+  Size *offsets;
+
+  count_heads_body(RandomAccessIterator keys, BinaryPredicate binary_pred, Decomposition decomp, Size *offsets)
+    : keys(keys), binary_pred(binary_pred), decomp(decomp), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &r) const
+  {
+    namespace internal = thrust::system::detail::internal::unique_detail;
+
+    for(Size t = r.begin(); t != r.end(); ++t)
+    {
+      offsets[t + 1] = internal::count_heads_tile(keys, decomp[t].begin(), decomp[t].end(), binary_pred);
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator, typename BinaryPredicate, typename Decomposition>
+  count_heads_body<RandomAccessIterator,BinaryPredicate,Decomposition>
+    make_count_heads_body(RandomAccessIterator keys, BinaryPredicate binary_pred, Decomposition decomp, typename Decomposition::index_type *offsets)
+{
+  return count_heads_body<RandomAccessIterator,BinaryPredicate,Decomposition>(keys, binary_pred, decomp, offsets);
+}
+
+
+// scans the per-tile counts in place, and returns the total
+template<typename Size>
+Size scan_counts(Size *offsets, Size num_tiles)
+{
+  offsets[0] = 0;
+
+  for(Size t = 0; t < num_tiles; ++t)
+  {
+    offsets[t + 1] += offsets[t];
+  }
+
+  return offsets[num_tiles];
+}
+
+
+} // end unique_detail
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+} // end namespace thrust
+
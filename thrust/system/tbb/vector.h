@@ -86,6 +86,12 @@ template<typename T, typename Allocator = allocator<T> >
      */
     explicit vector(size_type n, const value_type &value);
 
+    /*! This constructor creates a \p tbb::vector with \p n elements which are
+     *  left uninitialized if their type has a trivial default constructor.
+     *  \param n The size of the \p tbb::vector to create.
+     */
+    vector(size_type n, no_init_t);
+
     /*! Copy constructor copies from another \p tbb::vector.
      *  \param x The other \p tbb::vector to copy.
      */
@@ -23,6 +23,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/execution_policy.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/pair.h>
 
 namespace thrust
@@ -442,6 +443,174 @@ OutputIterator unique_copy(InputIterator first,
                            BinaryPredicate binary_pred);
 
 
+/*! \p unique_count counts the elements of the range <tt>[first, last)</tt>
+ *  which \p unique would keep: the first element of each group of
+ *  consecutive equal elements. It returns the size of the range which
+ *  \p unique would produce, without modifying the input or allocating an
+ *  output.
+ *
+ *  This version of \p unique_count uses \c operator== to test for equality.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last  The end of the input range.
+ *  \return The number of groups of consecutive equal elements in <tt>[first, last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="http://www.sgi.com/tech/stl/ForwardIterator.html">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/EqualityComparable.html">Equality Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p unique_count to
+ *  count the distinct values of a sorted sequence using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/unique.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 1, 2, 3, 3, 3, 7};
+ *  int count = thrust::unique_count(thrust::host, A, A + N);
+ *  // count is 4
+ *  \endcode
+ *
+ *  \see unique
+ */
+template<typename DerivedPolicy,
+         typename ForwardIterator>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last);
+
+
+/*! \p unique_count counts the elements of the range <tt>[first, last)</tt>
+ *  which \p unique would keep: the first element of each group of
+ *  consecutive equal elements. It returns the size of the range which
+ *  \p unique would produce, without modifying the input or allocating an
+ *  output.
+ *
+ *  This version of \p unique_count uses \c operator== to test for equality.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last  The end of the input range.
+ *  \return The number of groups of consecutive equal elements in <tt>[first, last)</tt>.
+ *
+ *  \tparam ForwardIterator is a model of <a href="http://www.sgi.com/tech/stl/ForwardIterator.html">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is a model of <a href="http://www.sgi.com/tech/stl/EqualityComparable.html">Equality Comparable</a>.
+ *
+ *  The following code snippet demonstrates how to use \p unique_count to
+ *  count the distinct values of a sorted sequence.
+ *
+ *  \code
+ *  #include <thrust/unique.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 1, 2, 3, 3, 3, 7};
+ *  int count = thrust::unique_count(A, A + N);
+ *  // count is 4
+ *  \endcode
+ *
+ *  \see unique
+ */
+template<typename ForwardIterator>
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(ForwardIterator first,
+               ForwardIterator last);
+
+
+/*! \p unique_count counts the elements of the range <tt>[first, last)</tt>
+ *  which \p unique would keep: the first element of each group of
+ *  consecutive equal elements. It returns the size of the range which
+ *  \p unique would produce, without modifying the input or allocating an
+ *  output.
+ *
+ *  This version of \p unique_count uses the function object \p binary_pred
+ *  to test for equality.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the input range.
+ *  \param last  The end of the input range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \return The number of groups of consecutive equal elements in <tt>[first, last)</tt>.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="http://www.sgi.com/tech/stl/ForwardIterator.html">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is convertible to \p BinaryPredicate's \c first_argument_type and to \p BinaryPredicate's \c second_argument_type.
+ *  \tparam BinaryPredicate is a model of <a href="http://www.sgi.com/tech/stl/BinaryPredicate.html">Binary Predicate</a>.
+ *
+ *  The following code snippet demonstrates how to use \p unique_count to
+ *  count the groups of a sequence using the \p thrust::host execution policy
+ *  for parallelization:
+ *
+ *  \code
+ *  #include <thrust/unique.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1};
+ *  int count = thrust::unique_count(thrust::host, A, A + N, thrust::equal_to<int>());
+ *  // count is 4
+ *  \endcode
+ *
+ *  \see unique
+ */
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename BinaryPredicate>
+__host__ __device__
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+               ForwardIterator first,
+               ForwardIterator last,
+               BinaryPredicate binary_pred);
+
+
+/*! \p unique_count counts the elements of the range <tt>[first, last)</tt>
+ *  which \p unique would keep: the first element of each group of
+ *  consecutive equal elements. It returns the size of the range which
+ *  \p unique would produce, without modifying the input or allocating an
+ *  output.
+ *
+ *  This version of \p unique_count uses the function object \p binary_pred
+ *  to test for equality.
+ *
+ *  \param first The beginning of the input range.
+ *  \param last  The end of the input range.
+ *  \param binary_pred  The binary predicate used to determine equality.
+ *  \return The number of groups of consecutive equal elements in <tt>[first, last)</tt>.
+ *
+ *  \tparam ForwardIterator is a model of <a href="http://www.sgi.com/tech/stl/ForwardIterator.html">Forward Iterator</a>,
+ *          and \p ForwardIterator's \c value_type is convertible to \p BinaryPredicate's \c first_argument_type and to \p BinaryPredicate's \c second_argument_type.
+ *  \tparam BinaryPredicate is a model of <a href="http://www.sgi.com/tech/stl/BinaryPredicate.html">Binary Predicate</a>.
+ *
+ *  The following code snippet demonstrates how to use \p unique_count to
+ *  count the groups of a sequence.
+ *
+ *  \code
+ *  #include <thrust/unique.h>
+ *  ...
+ *  const int N = 7;
+ *  int A[N] = {1, 3, 3, 3, 2, 2, 1};
+ *  int count = thrust::unique_count(A, A + N, thrust::equal_to<int>());
+ *  // count is 4
+ *  \endcode
+ *
+ *  \see unique
+ */
+template<typename ForwardIterator,
+         typename BinaryPredicate>
+typename thrust::iterator_traits<ForwardIterator>::difference_type
+  unique_count(ForwardIterator first,
+               ForwardIterator last,
+               BinaryPredicate binary_pred);
+
+
 /*! \p unique_by_key is a generalization of \p unique to key-value pairs.
  *  For each group of consecutive keys in the range <tt>[keys_first, keys_last)</tt>
  *  that are equal, \p unique_by_key removes all but the first element of 